@@ -0,0 +1,8 @@
+#! /usr/bin/env python3
+
+# Programs that are runnable.
+ns3_runnable_programs = ['build/scratch/subdir/ns3.33-subdir-debug', 'build/scratch/ns3.33-test-mmw-debug', 'build/scratch/ns3.33-scratch-simulator-debug']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = []
+
@@ -0,0 +1,8 @@
+/* WARNING! All changes made to this file will be lost! */
+
+#ifndef W_NS3_CONFIG_STORE_CONFIG_H_WAF
+#define W_NS3_CONFIG_STORE_CONFIG_H_WAF
+
+#define HAVE_LIBXML2 1
+
+#endif /* W_NS3_CONFIG_STORE_CONFIG_H_WAF */
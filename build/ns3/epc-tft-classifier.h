@@ -0,0 +1,163 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Nicola Baldo  <nbaldo@cttc.es>
+ */
+
+
+#ifndef EPC_TFT_CLASSIFIER_H
+#define EPC_TFT_CLASSIFIER_H
+
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/epc-tft.h"
+
+#include "ns3/ipv6-address.h"
+
+#include <map>
+#include <unordered_map>
+
+
+namespace ns3 {
+
+class EpcTft;
+class Packet;
+
+/**
+ * \brief classifies IP packets according to Traffic Flow Templates (TFTs)
+ *
+ * \note this implementation works with IPv4 and IPv6.
+ * When there is fragmentation of IP packets, UDP/TCP ports maybe missing.
+ *
+ * The following actions are performed to use the port info present in the first segment with
+ * the next fragments:
+ *  - Port info is stored if it is available, i.e. it is the first fragment with UDP/TCP protocol
+ *    and there is enough data in the payload of the IP packet for the port numbers.
+ *  - Port info is used for the next fragments.
+ *  - Port info is deleted, when the last fragment is processed.
+ *
+ * When we cannot cache the port info, the TFT of the default bearer is used. This may happen
+ * if there is reordering or losses of IP packets.
+ *
+ * The result of the classification of each flow (addresses, ports and
+ * type of service) is cached, so that only the first packets of a flow
+ * are matched against the TFTs. The cache is flushed when a TFT is added
+ * or deleted; the packet filters of a TFT must not be changed after it
+ * has been added to the classifier.
+ */
+class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
+{
+public:
+
+  EpcTftClassifier ();
+
+  /**
+   * add a TFT to the Classifier
+   *
+   * \param tft the TFT to be added
+   * \param id the ID of the bearer which will be classified by specified TFT classifier
+   *
+   */
+  void Add (Ptr<EpcTft> tft, uint32_t id);
+
+  /**
+   * delete an existing TFT from the classifier
+   *
+   * \param id the identifier of the TFT to be deleted
+   */
+  void Delete (uint32_t id);
+
+
+  /**
+   * classify an IP packet
+   *
+   * \param p the IP packet. The outmost header can only be an IPv4 or an IPv6 header.
+   * \param direction the EPC TFT direction (can be downlink, uplink or bi-directional)
+   * \param protocolNumber the protocol of the packet. Only IPv4 and IPv6 are supported.
+   *
+   * \return the identifier (>0) of the first TFT that matches with the IP packet; 0 if no TFT matched.
+   */
+  uint32_t Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t protocolNumber);
+
+protected:
+
+  /// The fields of a packet the TFTs are matched against
+  struct FlowKey
+  {
+    Ipv6Address remoteAddress; ///< remote address (IPv4-mapped for IPv4 packets)
+    Ipv6Address localAddress;  ///< local address (IPv4-mapped for IPv4 packets)
+    uint16_t protocolNumber;   ///< IPv4 or IPv6 protocol number
+    uint16_t remotePort;       ///< remote port
+    uint16_t localPort;        ///< local port
+    uint8_t direction;         ///< EPC TFT direction
+    uint8_t tos;               ///< type of service
+
+    /**
+     * \param other the key to compare with
+     * \return true if the two keys are equal
+     */
+    bool operator== (const FlowKey &other) const
+    {
+      return localPort == other.localPort && remotePort == other.remotePort
+             && tos == other.tos && direction == other.direction
+             && protocolNumber == other.protocolNumber
+             && localAddress == other.localAddress && remoteAddress == other.remoteAddress;
+    }
+  };
+
+  /// Hash function for FlowKey
+  struct FlowKeyHash
+  {
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    size_t operator() (const FlowKey &key) const
+    {
+      Ipv6AddressHash addressHash;
+      size_t h = addressHash (key.localAddress) ^ (addressHash (key.remoteAddress) * 31);
+      return h ^ ((static_cast<size_t> (key.localPort) << 16) | key.remotePort) ^ (key.tos << 8) ^ key.direction;
+    }
+  };
+
+  /// Classification result (TFT ID, 0 if no match) of each flow
+  typedef std::unordered_map<FlowKey, uint32_t, FlowKeyHash> FlowCache;
+
+  /// Number of cached flows above which the cache is flushed
+  static const uint32_t MAX_CACHED_FLOWS;
+
+  std::map <uint32_t, Ptr<EpcTft> > m_tftMap; ///< TFT map
+
+  FlowCache m_flowCache; ///< classification result of the flows seen so far
+
+  std::map < std::tuple<uint32_t, uint32_t, uint8_t, uint16_t>,
+             std::pair<uint32_t, uint32_t> >
+      m_classifiedIpv4Fragments; ///< Map with already classified IPv4 Fragments
+                                 ///< An entry is added when the port info is available, i.e.
+                                 ///<   first fragment, UDP/TCP protocols and enough payload data
+                                 ///< An entry is used if port info is not available, i.e.
+                                 ///<   not first fragment or not enough payload data for TCP/UDP
+                                 ///< An entry is removed when the last fragment is classified
+                                 ///<   Note: If last fragment is lost, entry is not removed
+};
+
+
+
+} // namespace ns3
+
+#endif /* TFT_CLASSIFIER_H */
@@ -27,6 +27,7 @@
 #include "log.h"
 
 #include <sstream>
+#include <vector>
 
 /**
  * \file
@@ -516,62 +517,73 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   else
     {
       // this is a normal attribute.
-      TypeId tid;
-      TypeId nextTid = root->GetInstanceTypeId ();
-      bool foundMatch = false;
-
-      do
+      std::vector<struct TypeId::AttributeInformation> attributes;
+      if (item == "*")
         {
-          tid = nextTid;
-
-          for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+          TypeId tid;
+          TypeId nextTid = root->GetInstanceTypeId ();
+          do
             {
-              struct TypeId::AttributeInformation info;
-              info = tid.GetAttribute (i);
-              if (info.name != item && item != "*")
-                {
-                  continue;
-                }
-              // attempt to cast to a pointer checker.
-              const PointerChecker *pChecker = dynamic_cast<const PointerChecker *> (PeekPointer (info.checker));
-              if (pChecker != 0)
+              tid = nextTid;
+              for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
                 {
-                  NS_LOG_DEBUG ("GetAttribute(ptr)=" << info.name << " on path=" << GetResolvedPath ());
-                  PointerValue pValue;
-                  root->GetAttribute (info.name, pValue);
-                  Ptr<Object> object = pValue.Get<Object> ();
-                  if (object == 0)
-                    {
-                      NS_LOG_ERROR ("Requested object name=\"" << item <<
-                                    "\" exists on path=\"" << GetResolvedPath () << "\""
-                                    " but is null.");
-                      continue;
-                    }
-                  foundMatch = true;
-                  m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
-                  m_workStack.pop_back ();
+                  attributes.push_back (tid.GetAttribute (i));
                 }
-              // attempt to cast to an object vector.
-              const ObjectPtrContainerChecker *vectorChecker =
-                dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
-              if (vectorChecker != 0)
+              nextTid = tid.GetParent ();
+            }
+          while (nextTid != tid);
+        }
+      else
+        {
+          // attribute names are unique along the TypeId hierarchy
+          struct TypeId::AttributeInformation info;
+          if (root->GetInstanceTypeId ().FindAttributeByName (item, &info))
+            {
+              attributes.push_back (info);
+            }
+        }
+
+      bool foundMatch = false;
+      for (std::vector<struct TypeId::AttributeInformation>::const_iterator i = attributes.begin ();
+           i != attributes.end (); ++i)
+        {
+          const struct TypeId::AttributeInformation &info = *i;
+          // attempt to cast to a pointer checker.
+          const PointerChecker *pChecker = dynamic_cast<const PointerChecker *> (PeekPointer (info.checker));
+          if (pChecker != 0)
+            {
+              NS_LOG_DEBUG ("GetAttribute(ptr)=" << info.name << " on path=" << GetResolvedPath ());
+              PointerValue pValue;
+              root->GetAttribute (info.name, pValue);
+              Ptr<Object> object = pValue.Get<Object> ();
+              if (object == 0)
                 {
-                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << pathLeft);
-                  foundMatch = true;
-                  ObjectPtrContainerValue vector;
-                  root->GetAttribute (info.name, vector);
-                  m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
-                  m_workStack.pop_back ();
+                  NS_LOG_ERROR ("Requested object name=\"" << item <<
+                                "\" exists on path=\"" << GetResolvedPath () << "\""
+                                " but is null.");
+                  continue;
                 }
-              // this could be anything else and we don't know what to do with it.
-              // So, we just ignore it.
+              foundMatch = true;
+              m_workStack.push_back (info.name);
+              DoResolve (pathLeft, object);
+              m_workStack.pop_back ();
             }
-
-          nextTid = tid.GetParent ();
+          // attempt to cast to an object vector.
+          const ObjectPtrContainerChecker *vectorChecker =
+            dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
+          if (vectorChecker != 0)
+            {
+              NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << pathLeft);
+              foundMatch = true;
+              ObjectPtrContainerValue vector;
+              root->GetAttribute (info.name, vector);
+              m_workStack.push_back (info.name);
+              DoArrayResolve (pathLeft, vector);
+              m_workStack.pop_back ();
+            }
+          // this could be anything else and we don't know what to do with it.
+          // So, we just ignore it.
         }
-      while (nextTid != tid);
 
       if (!foundMatch)
         {
@@ -25,10 +25,18 @@
 
 #include "ptr.h"
 #include "pointer.h"
+#include "string.h"
 #include "assert.h"
 #include "log.h"
+#include "fatal-error.h"
 
 #include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <fstream>
+#include <vector>
+#include <algorithm>
 
 
 /**
@@ -46,6 +54,41 @@ NS_LOG_COMPONENT_DEFINE ("DefaultSimulatorImpl");
 
 NS_OBJECT_ENSURE_REGISTERED (DefaultSimulatorImpl);
 
+namespace {
+
+/**
+ * \ingroup simulator
+ * Wall-clock time elapsed since a time point.
+ *
+ * \param [in] start The time point.
+ * \return The time elapsed, in nanoseconds.
+ */
+uint64_t
+ElapsedNs (std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>
+           (std::chrono::steady_clock::now () - start).count ();
+}
+
+/**
+ * \ingroup simulator
+ * Demangle the name of an event type.
+ *
+ * \param [in] type The type.
+ * \return The demangled name, or the mangled one if it cannot be demangled.
+ */
+std::string
+EventTypeName (std::type_index type)
+{
+  int status;
+  char *demangled = abi::__cxa_demangle (type.name (), NULL, NULL, &status);
+  std::string ret = (status == 0) ? demangled : type.name ();
+  std::free (demangled);
+  return ret;
+}
+
+} // unnamed namespace
+
 TypeId
 DefaultSimulatorImpl::GetTypeId (void)
 {
@@ -53,6 +96,13 @@ DefaultSimulatorImpl::GetTypeId (void)
     .SetParent<SimulatorImpl> ()
     .SetGroupName ("Core")
     .AddConstructor<DefaultSimulatorImpl> ()
+    .AddAttribute ("ProfileFile",
+                   "If not empty, the wall-clock time spent in each type of "
+                   "event and in each context is measured, and reported in "
+                   "this file at Simulator::Destroy.",
+                   StringValue (""),
+                   MakeStringAccessor (&DefaultSimulatorImpl::m_profileFile),
+                   MakeStringChecker ())
   ;
   return tid;
 }
@@ -74,6 +124,12 @@ DefaultSimulatorImpl::DefaultSimulatorImpl ()
   m_eventCount = 0;
   m_eventsWithContextEmpty = true;
   m_main = SystemThread::Self ();
+  m_profileInsert.count = 0;
+  m_profileInsert.ns = 0;
+  m_profileRemove.count = 0;
+  m_profileRemove.ns = 0;
+  m_profileQueueSum = 0;
+  m_profileQueueMax = 0;
 }
 
 DefaultSimulatorImpl::~DefaultSimulatorImpl ()
@@ -109,6 +165,10 @@ DefaultSimulatorImpl::Destroy ()
           ev->Invoke ();
         }
     }
+  if (!m_profileFile.empty ())
+    {
+      WriteProfile ();
+    }
 }
 
 void
@@ -138,7 +198,20 @@ DefaultSimulatorImpl::GetSystemId (void) const
 void
 DefaultSimulatorImpl::ProcessOneEvent (void)
 {
+  bool profiling = !m_profileFile.empty ();
+  std::chrono::steady_clock::time_point start;
+  if (profiling)
+    {
+      m_profileQueueSum += m_unscheduledEvents;
+      m_profileQueueMax = std::max (m_profileQueueMax, m_unscheduledEvents);
+      start = std::chrono::steady_clock::now ();
+    }
   Scheduler::Event next = m_events->RemoveNext ();
+  if (profiling)
+    {
+      m_profileRemove.count++;
+      m_profileRemove.ns += ElapsedNs (start);
+    }
 
   NS_ASSERT (next.key.m_ts >= m_currentTs);
   m_unscheduledEvents--;
@@ -148,7 +221,23 @@ DefaultSimulatorImpl::ProcessOneEvent (void)
   m_currentTs = next.key.m_ts;
   m_currentContext = next.key.m_context;
   m_currentUid = next.key.m_uid;
-  next.impl->Invoke ();
+  if (profiling)
+    {
+      std::type_index type = typeid (*next.impl);
+      start = std::chrono::steady_clock::now ();
+      next.impl->Invoke ();
+      uint64_t ns = ElapsedNs (start);
+      ProfileEntry &byType = m_profileByType[type];
+      byType.count++;
+      byType.ns += ns;
+      ProfileEntry &byContext = m_profileByContext[std::make_pair (next.key.m_context, type)];
+      byContext.count++;
+      byContext.ns += ns;
+    }
+  else
+    {
+      next.impl->Invoke ();
+    }
   next.impl->Unref ();
 
   ProcessEventsWithContext ();
@@ -186,7 +275,75 @@ DefaultSimulatorImpl::ProcessEventsWithContext (void)
       ev.key.m_uid = m_uid;
       m_uid++;
       m_unscheduledEvents++;
+      InsertEvent (ev);
+    }
+}
+
+void
+DefaultSimulatorImpl::InsertEvent (const Scheduler::Event &ev)
+{
+  if (m_profileFile.empty ())
+    {
       m_events->Insert (ev);
+      return;
+    }
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  m_events->Insert (ev);
+  m_profileInsert.count++;
+  m_profileInsert.ns += ElapsedNs (start);
+}
+
+void
+DefaultSimulatorImpl::WriteProfile (void) const
+{
+  std::ofstream os (m_profileFile.c_str ());
+  std::ofstream folded ((m_profileFile + ".folded").c_str ());
+  if (!os.is_open () || !folded.is_open ())
+    {
+      NS_FATAL_ERROR ("Cannot open the profile file " << m_profileFile);
+    }
+
+  uint64_t count = 0;
+  uint64_t ns = 0;
+  std::vector<std::pair<uint64_t, std::type_index> > byTime;
+  for (std::map<std::type_index, ProfileEntry>::const_iterator i = m_profileByType.begin ();
+       i != m_profileByType.end (); ++i)
+    {
+      count += i->second.count;
+      ns += i->second.ns;
+      byTime.push_back (std::make_pair (i->second.ns, i->first));
+    }
+  std::sort (byTime.rbegin (), byTime.rend ());
+
+  os << "events " << count << " time(ms) " << ns / 1000000.0 << std::endl;
+  os << "scheduler insert " << m_profileInsert.count
+     << " time(ms) " << m_profileInsert.ns / 1000000.0 << std::endl;
+  os << "scheduler remove " << m_profileRemove.count
+     << " time(ms) " << m_profileRemove.ns / 1000000.0 << std::endl;
+  os << "queue size mean " << (count ? (double) m_profileQueueSum / count : 0)
+     << " max " << m_profileQueueMax << std::endl;
+  os << std::endl << "# time(ms) count mean(us) type" << std::endl;
+  for (std::vector<std::pair<uint64_t, std::type_index> >::const_iterator i = byTime.begin ();
+       i != byTime.end (); ++i)
+    {
+      const ProfileEntry &entry = m_profileByType.find (i->second)->second;
+      os << entry.ns / 1000000.0 << " " << entry.count
+         << " " << entry.ns / 1000.0 / entry.count
+         << " " << EventTypeName (i->second) << std::endl;
+    }
+
+  for (std::map<std::pair<uint32_t, std::type_index>, ProfileEntry>::const_iterator i = m_profileByContext.begin ();
+       i != m_profileByContext.end (); ++i)
+    {
+      if (i->first.first == Simulator::NO_CONTEXT)
+        {
+          folded << "no context";
+        }
+      else
+        {
+          folded << "context " << i->first.first;
+        }
+      folded << ";" << EventTypeName (i->first.second) << " " << i->second.ns << std::endl;
     }
 }
 
@@ -242,7 +399,7 @@ DefaultSimulatorImpl::Schedule (Time const &delay, EventImpl *event)
   ev.key.m_uid = m_uid;
   m_uid++;
   m_unscheduledEvents++;
-  m_events->Insert (ev);
+  InsertEvent (ev);
   return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
 }
 
@@ -261,7 +418,7 @@ DefaultSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay,
       ev.key.m_uid = m_uid;
       m_uid++;
       m_unscheduledEvents++;
-      m_events->Insert (ev);
+      InsertEvent (ev);
     }
   else
     {
@@ -290,7 +447,7 @@ DefaultSimulatorImpl::ScheduleNow (EventImpl *event)
   ev.key.m_uid = m_uid;
   m_uid++;
   m_unscheduledEvents++;
-  m_events->Insert (ev);
+  InsertEvent (ev);
   return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
 }
 
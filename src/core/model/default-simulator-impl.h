@@ -30,6 +30,10 @@
 #include "ptr.h"
 
 #include <list>
+#include <map>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
 
 /**
  * \file
@@ -43,6 +47,16 @@ namespace ns3 {
  * \ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * When the ProfileFile attribute is set, the wall-clock time spent in
+ * each event is measured and aggregated by event type (the dynamic
+ * type of the EventImpl, which for the events made by MakeEvent names
+ * the class and the signature of the function called) and by context.
+ * The time spent inserting and removing events from the Scheduler and
+ * the size of the event queue are measured as well.  The report is
+ * written to that file at Simulator::Destroy(), and the time per
+ * context and event type to the same file name with a ".folded"
+ * suffix, in the folded stack format read by flame graph tools.
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -86,6 +100,15 @@ private:
   void ProcessOneEvent (void);
   /** Move events from a different context into the main event queue. */
   void ProcessEventsWithContext (void);
+  /**
+   * Insert an event in the event queue, measuring the time spent
+   * if profiling.
+   *
+   * \param [in] ev The event to insert.
+   */
+  void InsertEvent (const Scheduler::Event &ev);
+  /** Write the profiling report to m_profileFile. */
+  void WriteProfile (void) const;
 
   /** Wrap an event with its execution context. */
   struct EventWithContext
@@ -136,6 +159,29 @@ private:
 
   /** Main execution thread. */
   SystemThread::ThreadId m_main;
+
+  /** Number of operations and the wall-clock time they took. */
+  struct ProfileEntry
+  {
+    /** Number of operations. */
+    uint64_t count;
+    /** Total wall-clock time, in nanoseconds. */
+    uint64_t ns;
+  };
+  /** The file of the profiling report, or empty to disable profiling. */
+  std::string m_profileFile;
+  /** The events run, by EventImpl dynamic type. */
+  std::map<std::type_index, ProfileEntry> m_profileByType;
+  /** The events run, by context and EventImpl dynamic type. */
+  std::map<std::pair<uint32_t, std::type_index>, ProfileEntry> m_profileByContext;
+  /** The Scheduler insertions. */
+  ProfileEntry m_profileInsert;
+  /** The Scheduler removals. */
+  ProfileEntry m_profileRemove;
+  /** Sum of the event queue sizes seen by the events run. */
+  uint64_t m_profileQueueSum;
+  /** Largest event queue size seen by the events run. */
+  int m_profileQueueMax;
 };
 
 } // namespace ns3
@@ -61,9 +61,16 @@ class int64x64_t
    * We could make this a static and initialize in int64x64-128.cc or
    * int64x64.cc, but this requires handling static initialization order
    * when most of the implementation is inline.  Instead, we resort to
-   * this define.
+   * this define, spelled as a literal so that it is a constant even in
+   * unoptimized builds.
    */
-#define HP_MAX_64    (std::pow (2.0L, 64))
+#define HP_MAX_64    18446744073709551616.0L
+  /**
+   * Floating point value of 1 / HP_MAX_64.
+   * Being a power of two, multiplying by it is exact, and is the same as
+   * dividing by HP_MAX_64.
+   */
+#define HP_INV_MAX_64    5.42101086242752217003726400434970855712890625e-20L
 
 public:
   /**
@@ -208,7 +215,7 @@ public:
     const bool negative = _v < 0;
     const uint128_t value = negative ? -_v : _v;
     const long double fhi = value >> 64;
-    const long double flo = (value & HP_MASK_LO) / HP_MAX_64;
+    const long double flo = (value & HP_MASK_LO) * HP_INV_MAX_64;
     long double retval = fhi;
     retval += flo;
     retval = negative ? -retval : retval;
@@ -513,6 +520,34 @@ inline int64x64_t operator ! (const int64x64_t & lhs)
   return int64x64_t (!lhs._v);
 }
 
+// MulByInvert completes the conversions between Time units, so it is
+// inlined to keep Time::To and Time::From free of function calls.
+inline void
+int64x64_t::MulByInvert (const int64x64_t & o)
+{
+  bool negResult = _v < 0;
+  uint128_t a = negResult ? -_v : _v;
+  uint128_t result = UmulByInvert (a, o._v);
+
+  _v = negResult ? -result : result;
+}
+
+inline uint128_t
+int64x64_t::UmulByInvert (const uint128_t a, const uint128_t b)
+{
+  uint128_t result, ah, bh, al, bl;
+  uint128_t hi, mid;
+  ah = a >> 64;
+  bh = b >> 64;
+  al = a & HP_MASK_LO;
+  bl = b & HP_MASK_LO;
+  hi = ah * bh;
+  mid = ah * bl + al * bh;
+  mid >>= 64;
+  result = hi + mid;
+  return result;
+}
+
 
 } // namespace ns3
 
@@ -53,9 +53,16 @@ class int64x64_t
    * We could make this a static and initialize in int64x64-cairo.cc or
    * int64x64.cc, but this requires handling static initialization order
    * when most of the implementation is inline.  Instead, we resort to
-   * this define.
+   * this define, spelled as a literal so that it is a constant even in
+   * unoptimized builds.
    */
-#define HP_MAX_64    (std::pow (2.0L, 64))
+#define HP_MAX_64    18446744073709551616.0L
+  /**
+   * Floating point value of 1 / HP_MAX_64.
+   * Being a power of two, multiplying by it is exact, and is the same as
+   * dividing by HP_MAX_64.
+   */
+#define HP_INV_MAX_64    5.42101086242752217003726400434970855712890625e-20L
 
 public:
   /**
@@ -201,7 +208,7 @@ public:
     const bool negative = _cairo_int128_negative (_v);
     const cairo_int128_t value = negative ? _cairo_int128_negate (_v) : _v;
     const long double fhi = static_cast<long double> (value.hi);
-    const long double flo = value.lo / HP_MAX_64;
+    const long double flo = value.lo * HP_INV_MAX_64;
     long double retval = fhi;
     retval += flo;
     retval = negative ? -retval : retval;
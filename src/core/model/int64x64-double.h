@@ -52,9 +52,16 @@ class int64x64_t
    * We could make this a static and initialize in int64x64-double.cc or
    * int64x64.cc, but this requires handling static initialization order
    * when most of the implementation is inline.  Instead, we resort to
-   * this define.
+   * this define, spelled as a literal so that it is a constant even in
+   * unoptimized builds.
    */
-#define HP_MAX_64    (std::pow (2.0L, 64))
+#define HP_MAX_64    18446744073709551616.0L
+  /**
+   * Floating point value of 1 / HP_MAX_64.
+   * Being a power of two, multiplying by it is exact, and is the same as
+   * dividing by HP_MAX_64.
+   */
+#define HP_INV_MAX_64    5.42101086242752217003726400434970855712890625e-20L
 
 public:
   /**
@@ -128,7 +135,7 @@ public:
     const bool negative = hi < 0;
     const long double hild = static_cast<long double> (hi);
     const long double fhi = negative ? -hild : hild;
-    const long double flo = lo / HP_MAX_64;
+    const long double flo = lo * HP_INV_MAX_64;
     _v = negative ? -fhi : fhi;
     _v += flo;
     // _v = negative ? -_v : _v;
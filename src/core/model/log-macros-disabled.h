@@ -90,6 +90,9 @@
 #define NS_LOG_UNCOND(msg) \
   NS_LOG_NOOP_INTERNAL (msg)
 
+#define NS_LOG_RATE_LIMITED(level, rate, msg) \
+  NS_LOG_NOOP_INTERNAL (msg)
+
 
 #endif /* !NS3_LOG_ENABLE */
 
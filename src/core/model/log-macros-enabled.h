@@ -147,6 +147,25 @@
 #endif /* NS_LOG_APPEND_CONTEXT */
 
 
+#ifndef NS3_LOG_COMPILE_MASK
+/**
+ * \ingroup logging
+ * The LogLevels compiled in.
+ *
+ * The NS_LOG macros of the levels outside of this mask are reduced to
+ * dead code, whatever the LogComponent settings at run time.  It is
+ * set for the whole build with `./waf configure --log-levels=...`,
+ * which passes it on the compiler command line.  A single file can
+ * override it after its includes; the `#undef` is needed since the
+ * macro is always already defined at that point:
+ * \code
+ *   #undef NS3_LOG_COMPILE_MASK
+ *   #define NS3_LOG_COMPILE_MASK (ns3::LOG_ERROR | ns3::LOG_WARN)
+ * \endcode
+ */
+#define NS3_LOG_COMPILE_MASK ns3::LOG_ALL
+#endif
+
 #ifndef NS_LOG_CONDITION
 /**
  * \ingroup logging
@@ -187,7 +206,8 @@
 #define NS_LOG(level, msg)                                      \
   NS_LOG_CONDITION                                              \
   do {                                                          \
-      if (g_log.IsEnabled (level))                              \
+      if (((level) & NS3_LOG_COMPILE_MASK)                      \
+          && g_log.IsEnabled (level))                           \
         {                                                       \
           NS_LOG_APPEND_TIME_PREFIX;                            \
           NS_LOG_APPEND_NODE_PREFIX;                            \
@@ -209,7 +229,8 @@
 #define NS_LOG_FUNCTION_NOARGS()                                \
   NS_LOG_CONDITION                                              \
   do {                                                          \
-      if (g_log.IsEnabled (ns3::LOG_FUNCTION))                  \
+      if ((ns3::LOG_FUNCTION & NS3_LOG_COMPILE_MASK)            \
+          && g_log.IsEnabled (ns3::LOG_FUNCTION))               \
         {                                                       \
           NS_LOG_APPEND_TIME_PREFIX;                            \
           NS_LOG_APPEND_NODE_PREFIX;                            \
@@ -245,7 +266,8 @@
   NS_LOG_CONDITION                                              \
   do                                                            \
     {                                                           \
-      if (g_log.IsEnabled (ns3::LOG_FUNCTION))                  \
+      if ((ns3::LOG_FUNCTION & NS3_LOG_COMPILE_MASK)            \
+          && g_log.IsEnabled (ns3::LOG_FUNCTION))               \
         {                                                       \
           NS_LOG_APPEND_TIME_PREFIX;                            \
           NS_LOG_APPEND_NODE_PREFIX;                            \
@@ -259,6 +281,42 @@
   while (false)
 
 
+/**
+ * \ingroup logging
+ *
+ * Log a message at a specific log level, at most \c rate times per
+ * second of wall-clock time for this call site.
+ *
+ * This is meant for the messages in hot loops, such as the dumps of
+ * whole SpectrumValues, which would otherwise dominate the run time
+ * as soon as their LogComponent is enabled.  The first message
+ * printed after some were dropped reports how many.
+ *
+ * \param [in] level The log level
+ * \param [in] rate The number of messages per second, also the burst
+ * \param [in] msg The message to log
+ */
+#define NS_LOG_RATE_LIMITED(level, rate, msg)                   \
+  NS_LOG_CONDITION                                              \
+  do {                                                          \
+      if (((level) & NS3_LOG_COMPILE_MASK)                      \
+          && g_log.IsEnabled (level))                           \
+        {                                                       \
+          static ns3::LogRateLimiter ns3LogRateLimiter (rate);  \
+          if (ns3LogRateLimiter.Allow ())                       \
+            {                                                   \
+              NS_LOG_APPEND_TIME_PREFIX;                        \
+              NS_LOG_APPEND_NODE_PREFIX;                        \
+              NS_LOG_APPEND_CONTEXT;                            \
+              NS_LOG_APPEND_FUNC_PREFIX;                        \
+              NS_LOG_APPEND_LEVEL_PREFIX (level);               \
+              std::clog << msg;                                 \
+              ns3LogRateLimiter.AppendSuppressed (std::clog);   \
+              std::clog << std::endl;                           \
+            }                                                   \
+        }                                                       \
+    } while (false)
+
 /**
  * \ingroup logging
  *
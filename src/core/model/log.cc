@@ -29,6 +29,8 @@
 
 #include <cstdlib>    // getenv
 #include <cstring>    // strlen
+#include <algorithm>  // min
+#include <chrono>
 
 /**
  * \file
@@ -641,6 +643,43 @@ NodePrinter LogGetNodePrinter (void)
 }
 
 
+LogRateLimiter::LogRateLimiter (double rate)
+  : m_rate (rate),
+    m_tokens (rate),
+    m_last (0),
+    m_suppressed (0)
+{}
+
+bool
+LogRateLimiter::Allow (void)
+{
+  int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>
+    (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+  if (m_last != 0)
+    {
+      m_tokens = std::min (m_rate, m_tokens + m_rate * (now - m_last) * 1e-9);
+    }
+  m_last = now;
+  if (m_tokens < 1)
+    {
+      m_suppressed++;
+      return false;
+    }
+  m_tokens--;
+  return true;
+}
+
+void
+LogRateLimiter::AppendSuppressed (std::ostream &os)
+{
+  if (m_suppressed != 0)
+    {
+      os << " [" << m_suppressed << " suppressed]";
+      m_suppressed = 0;
+    }
+}
+
+
 ParameterLogger::ParameterLogger (std::ostream &os)
   : m_first (true),
     m_os (os)
@@ -442,6 +442,48 @@ private:
  */
 LogComponent & GetLogComponent (const std::string name);
 
+/**
+ * \ingroup logging
+ *
+ * Token bucket limiting the rate of the messages of a log site.
+ *
+ * NS_LOG_RATE_LIMITED holds one instance per call site.  The bucket
+ * holds up to \c rate tokens, refilled at \c rate tokens per second
+ * of wall-clock time, and each message printed takes one.
+ */
+class LogRateLimiter
+{
+public:
+  /**
+   * Constructor.
+   *
+   * \param [in] rate The number of messages per second, also the burst.
+   */
+  LogRateLimiter (double rate);
+
+  /**
+   * Take a token for a new message.
+   *
+   * \return \c true if the message can be printed, \c false if it
+   *         must be dropped.
+   */
+  bool Allow (void);
+
+  /**
+   * Report the number of messages dropped since the last one printed,
+   * if any, and reset it.
+   *
+   * \param [in] os The output stream of the message.
+   */
+  void AppendSuppressed (std::ostream &os);
+
+private:
+  double m_rate;          //!< Tokens added per second.
+  double m_tokens;        //!< Tokens available.
+  int64_t m_last;         //!< Time of the last refill, in nanoseconds.
+  uint64_t m_suppressed;  //!< Messages dropped since the last one printed.
+};
+
 /**
  * Insert `, ` when streaming function arguments.
  */
@@ -103,6 +103,7 @@ Object::Object ()
   NS_LOG_FUNCTION (this);
   m_aggregates->n = 1;
   m_aggregates->buffer[0] = this;
+  ClearAggregatesCache (m_aggregates);
 }
 Object::~Object ()
 {
@@ -120,6 +121,8 @@ Object::~Object ()
           m_aggregates->n--;
         }
     }
+  // the cache may point to this object
+  ClearAggregatesCache (m_aggregates);
   // finally, if all objects have been removed from the list,
   // delete the aggregate list
   if (m_aggregates->n == 0)
@@ -137,6 +140,17 @@ Object::Object (const Object &o)
 {
   m_aggregates->n = 1;
   m_aggregates->buffer[0] = this;
+  ClearAggregatesCache (m_aggregates);
+}
+Object &
+Object::operator = (const Object &o)
+{
+  NS_LOG_FUNCTION (this << &o);
+  if (this != &o)
+    {
+      m_tid = o.m_tid;
+    }
+  return *this;
 }
 void
 Object::Construct (const AttributeConstructionList &attributes)
@@ -151,6 +165,13 @@ Object::DoGetObject (TypeId tid) const
   NS_LOG_FUNCTION (this << tid);
   NS_ASSERT (CheckLoose ());
 
+  uint16_t uid = tid.GetUid ();
+  uint32_t slot = uid % (sizeof (m_aggregates->cacheUid) / sizeof (m_aggregates->cacheUid[0]));
+  if (m_aggregates->cacheUid[slot] == uid)
+    {
+      return m_aggregates->cacheObject[slot];
+    }
+
   uint32_t n = m_aggregates->n;
   TypeId objectTid = Object::GetTypeId ();
   for (uint32_t i = 0; i < n; i++)
@@ -173,6 +194,9 @@ Object::DoGetObject (TypeId tid) const
           current->m_getObjectCount++;
           // then, update the sort
           UpdateSortedArray (m_aggregates, i);
+          // remember the match for the next lookups of this TypeId
+          m_aggregates->cacheUid[slot] = uid;
+          m_aggregates->cacheObject[slot] = current;
           // finally, return the match
           return const_cast<Object *> (current);
         }
@@ -236,6 +260,12 @@ restart:
     }
 }
 void
+Object::ClearAggregatesCache (struct Aggregates *aggregates)
+{
+  std::memset (aggregates->cacheUid, 0, sizeof (aggregates->cacheUid));
+  std::memset (aggregates->cacheObject, 0, sizeof (aggregates->cacheObject));
+}
+void
 Object::UpdateSortedArray (struct Aggregates *aggregates, uint32_t j) const
 {
   NS_LOG_FUNCTION (this << aggregates << j);
@@ -263,6 +293,7 @@ Object::AggregateObject (Ptr<Object> o)
   struct Aggregates *aggregates =
     (struct Aggregates *)std::malloc (sizeof(struct Aggregates) + (total - 1) * sizeof(Object*));
   aggregates->n = total;
+  ClearAggregatesCache (aggregates);
 
   // copy our buffer to the new buffer
   std::memcpy (&aggregates->buffer[0],
@@ -294,6 +294,17 @@ protected:
    * valid state.
    */
   Object (const Object &o);
+  /**
+   * Assign an Object.
+   *
+   * \param [in] o the Object to assign.
+   * \return a reference to this Object.
+   *
+   * Like the copy constructor, this does _not_ copy the aggregated
+   * Objects: this Object stays in its own aggregate, which would
+   * otherwise be shared with (and freed together with) \p o.
+   */
+  Object &operator = (const Object &o);
 
 private:
 
@@ -341,15 +352,32 @@ private:
    * chunk of memory than the struct to allow space for a larger
    * variable sized buffer whose size is indicated by the element
    * \c n
+   *
+   * The most recent successful lookups are cached in a small
+   * direct-mapped table indexed by the TypeId uid, so that repeated
+   * GetObject calls for the same type do not walk the array and the
+   * TypeId parent chains again.  A new Aggregates starts with an
+   * empty cache, hence AggregateObject invalidates it.
    */
   struct Aggregates
   {
     /** The number of entries in \c buffer. */
     uint32_t n;
+    /** The TypeId uids of the cached lookups, 0 for an empty entry. */
+    uint16_t cacheUid[4];
+    /** The Objects found by the cached lookups. */
+    Object *cacheObject[4];
     /** The array of Objects. */
     Object *buffer[1];
   };
 
+  /**
+   * Empty the lookup cache of an Aggregates.
+   *
+   * \param [in] aggregates The Aggregates to update
+   */
+  static void ClearAggregatesCache (struct Aggregates *aggregates);
+
   /**
    * Find an Object of TypeId tid in the aggregates of this Object.
    *
@@ -196,6 +196,28 @@ UniformRandomVariable::GetInteger (uint32_t min, uint32_t max)
   NS_ASSERT (min <= max);
   return static_cast<uint32_t> ( GetValue ((double) (min), (double) (max) + 1.0) );
 }
+void
+UniformRandomVariable::GetValues (double *values, std::size_t n, double min, double max)
+{
+  NS_LOG_FUNCTION (this << values << n << min << max);
+  RngStream *stream = Peek ();
+  bool antithetic = IsAntithetic ();
+  for (std::size_t i = 0; i < n; i++)
+    {
+      double v = min + stream->RandU01 () * (max - min);
+      if (antithetic)
+        {
+          v = min + (max - v);
+        }
+      values[i] = v;
+    }
+}
+void
+UniformRandomVariable::GetValues (double *values, std::size_t n)
+{
+  NS_LOG_FUNCTION (this << values << n);
+  GetValues (values, n, m_min, m_max);
+}
 
 double
 UniformRandomVariable::GetValue (void)
@@ -432,6 +454,28 @@ ExponentialRandomVariable::GetInteger (uint32_t mean, uint32_t bound)
   NS_LOG_FUNCTION (this << mean << bound);
   return static_cast<uint32_t> ( GetValue (mean, bound) );
 }
+void
+ExponentialRandomVariable::GetValues (double *values, std::size_t n)
+{
+  NS_LOG_FUNCTION (this << values << n);
+  RngStream *stream = Peek ();
+  bool antithetic = IsAntithetic ();
+  std::size_t i = 0;
+  while (i < n)
+    {
+      double v = stream->RandU01 ();
+      if (antithetic)
+        {
+          v = (1 - v);
+        }
+      double r = -m_mean*std::log (v);
+      // same rejection of the values above the bound as GetValue
+      if (m_bound == 0 || r <= m_bound)
+        {
+          values[i++] = r;
+        }
+    }
+}
 
 double
 ExponentialRandomVariable::GetValue (void)
@@ -702,10 +746,28 @@ double
 NormalRandomVariable::GetValue (double mean, double variance, double bound)
 {
   NS_LOG_FUNCTION (this << mean << variance << bound);
+  return DoGetValue (Peek (), mean, std::sqrt (variance), bound);
+}
+
+void
+NormalRandomVariable::GetValues (double *values, std::size_t n)
+{
+  NS_LOG_FUNCTION (this << values << n);
+  RngStream *stream = Peek ();
+  double stddev = std::sqrt (m_variance);
+  for (std::size_t i = 0; i < n; i++)
+    {
+      values[i] = DoGetValue (stream, m_mean, stddev, m_bound);
+    }
+}
+
+double
+NormalRandomVariable::DoGetValue (RngStream *stream, double mean, double stddev, double bound)
+{
   if (m_nextValid)
     { // use previously generated
       m_nextValid = false;
-      double x2 = mean + m_v2 * m_y * std::sqrt (variance);
+      double x2 = mean + m_v2 * m_y * stddev;
       if (std::fabs (x2 - mean) <= bound)
         {
           return x2;
@@ -715,8 +777,8 @@ NormalRandomVariable::GetValue (double mean, double variance, double bound)
     { // See Simulation Modeling and Analysis p. 466 (Averill Law)
       // for algorithm; basically a Box-Muller transform:
       // http://en.wikipedia.org/wiki/Box-Muller_transform
-      double u1 = Peek ()->RandU01 ();
-      double u2 = Peek ()->RandU01 ();
+      double u1 = stream->RandU01 ();
+      double u2 = stream->RandU01 ();
       if (IsAntithetic ())
         {
           u1 = (1 - u1);
@@ -728,7 +790,7 @@ NormalRandomVariable::GetValue (double mean, double variance, double bound)
       if (w <= 1.0)
         { // Got good pair
           double y = std::sqrt ((-2 * std::log (w)) / w);
-          double x1 = mean + v1 * y * std::sqrt (variance);
+          double x1 = mean + v1 * y * stddev;
           // if x1 is in bounds, return it, cache v2 and y
           if (std::fabs (x1 - mean) <= bound)
             {
@@ -738,7 +800,7 @@ NormalRandomVariable::GetValue (double mean, double variance, double bound)
               return x1;
             }
           // otherwise try and return the other if it is valid
-          double x2 = mean + v2 * y * std::sqrt (variance);
+          double x2 = mean + v2 * y * stddev;
           if (std::fabs (x2 - mean) <= bound)
             {
               m_nextValid = false;
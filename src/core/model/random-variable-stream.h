@@ -30,6 +30,7 @@
 #include "object.h"
 #include "attribute-helper.h"
 #include <stdint.h>
+#include <cstddef>
 
 /**
  * \file
@@ -281,6 +282,32 @@ public:
    */
   uint32_t GetInteger (uint32_t min, uint32_t max);
 
+  /**
+   * \brief Fill an array with the next random values, as doubles in
+   * the specified range \f$[min, max)\f$.
+   *
+   * The values are the ones, in the same order, that \p n calls to
+   * GetValue (min, max) would return.
+   *
+   * \param [out] values The array to fill.
+   * \param [in] n The number of values to draw.
+   * \param [in] min Low end of the range (included).
+   * \param [in] max High end of the range (excluded).
+   */
+  void GetValues (double *values, std::size_t n, double min, double max);
+
+  /**
+   * \brief Fill an array with the next random values drawn from the
+   * distribution.
+   *
+   * The values are the ones, in the same order, that \p n calls to
+   * GetValue (void) would return.
+   *
+   * \param [out] values The array to fill.
+   * \param [in] n The number of values to draw.
+   */
+  void GetValues (double *values, std::size_t n);
+
   // Inherited from RandomVariableStream
   /**
    * \brief Get the next random value as a double drawn from the distribution.
@@ -583,6 +610,18 @@ public:
    */
   uint32_t GetInteger (uint32_t mean, uint32_t bound);
 
+  /**
+   * \brief Fill an array with the next random values drawn from the
+   * distribution.
+   *
+   * The values are the ones, in the same order, that \p n calls to
+   * GetValue (void) would return.
+   *
+   * \param [out] values The array to fill.
+   * \param [in] n The number of values to draw.
+   */
+  void GetValues (double *values, std::size_t n);
+
   // Inherited from RandomVariableStream
   virtual double GetValue (void);
   virtual uint32_t GetInteger (void);
@@ -1152,6 +1191,19 @@ public:
    */
   uint32_t GetInteger (uint32_t mean, uint32_t variance, uint32_t bound);
 
+  /**
+   * \brief Fill an array with random doubles from a normal distribution
+   * with the current mean, variance, and bound.
+   *
+   * The values are the ones, in the same order, that \p n calls to
+   * GetValue (void) would return, including the second value of the
+   * last pair, which is left for the next call.
+   *
+   * \param [out] values The array to fill.
+   * \param [in] n The number of values to draw.
+   */
+  void GetValues (double *values, std::size_t n);
+
   /**
    * \brief Returns a random double from a normal distribution with the current mean, variance, and bound.
    * \return A floating point random value.
@@ -1228,6 +1280,16 @@ public:
   virtual uint32_t GetInteger (void);
 
 private:
+  /**
+   * \brief Returns a random double from a normal distribution.
+   * \param [in] stream The underlying stream, from Peek ().
+   * \param [in] mean Mean value for the normal distribution.
+   * \param [in] stddev Standard deviation of the normal distribution.
+   * \param [in] bound Bound on values returned.
+   * \return A floating point random value.
+   */
+  double DoGetValue (RngStream *stream, double mean, double stddev, double bound);
+
   /** The mean value for the normal distribution returned by this RNG stream. */
   double m_mean;
 
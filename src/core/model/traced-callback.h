@@ -90,6 +90,23 @@ public:
    */
   void operator() (Ts... args) const;
 
+  /**
+   * Checks if the chain of Callbacks is empty.
+   *
+   * The arguments of a trace are evaluated even when nothing is
+   * connected to it; call sites building costly arguments (copies of
+   * containers, trace structures) can test this first to skip them:
+   * \code
+   *   if (!m_rxTrace.IsEmpty ())
+   *     {
+   *       m_rxTrace (BuildTraceParams ());
+   *     }
+   * \endcode
+   *
+   * \return \c true if no Callback is connected.
+   */
+  bool IsEmpty (void) const;
+
   /**
    *  TracedCallback signature for POD.
    *
@@ -178,6 +195,12 @@ TracedCallback<Ts...>::Disconnect (const CallbackBase & callback, std::string pa
   DisconnectWithoutContext (realCb);
 }
 template<typename... Ts>
+bool
+TracedCallback<Ts...>::IsEmpty (void) const
+{
+  return m_callbackList.empty ();
+}
+template<typename... Ts>
 void
 TracedCallback<Ts...>::operator() (Ts... args) const
 {
@@ -24,6 +24,7 @@
 #include "trace-source-accessor.h"
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <sstream>
 #include <iomanip>
@@ -229,6 +230,14 @@ public:
    * \returns The information associated to attribute whose index is \pname{i}.
    */
   struct TypeId::AttributeInformation GetAttribute (uint16_t uid, std::size_t i) const;
+  /**
+   * Find an Attribute declared by a type, ignoring its parents.
+   * \param [in] uid The id.
+   * \param [in] name The Attribute name.
+   * \returns The information associated to the Attribute \pname{name},
+   *          or \c 0 if \pname{uid} does not declare it.
+   */
+  const struct TypeId::AttributeInformation * FindAttribute (uint16_t uid, const std::string &name) const;
   /**
    * Record a new TraceSource.
    * \param [in] uid The id.
@@ -264,6 +273,14 @@ public:
    * \returns Detailed information about the requested trace source.
    */
   struct TypeId::TraceSourceInformation GetTraceSource (uint16_t uid, std::size_t i) const;
+  /**
+   * Find a TraceSource declared by a type, ignoring its parents.
+   * \param [in] uid The id.
+   * \param [in] name The TraceSource name.
+   * \returns The information associated to the TraceSource \pname{name},
+   *          or \c 0 if \pname{uid} does not declare it.
+   */
+  const struct TypeId::TraceSourceInformation * FindTraceSource (uint16_t uid, const std::string &name) const;
   /**
    * Check if this TypeId should not be listed in documentation.
    * \param [in] uid The id.
@@ -316,6 +333,10 @@ private:
     std::vector<struct TypeId::AttributeInformation> attributes;
     /** The container of TraceSources. */
     std::vector<struct TypeId::TraceSourceInformation> traceSources;
+    /** The index of \c attributes by name. */
+    std::unordered_map<std::string, std::size_t> attributeIndex;
+    /** The index of \c traceSources by name. */
+    std::unordered_map<std::string, std::size_t> traceSourceIndex;
     /** Support level/deprecation. */
     TypeId::SupportLevel supportLevel;
     /** Support message. */
@@ -617,27 +638,22 @@ IidManager::HasAttribute (uint16_t uid,
                           std::string name)
 {
   NS_LOG_FUNCTION (IID << uid << name);
-  struct IidInformation *information  = LookupInformation (uid);
   while (true)
     {
-      for (std::vector<struct TypeId::AttributeInformation>::const_iterator i = information->attributes.begin ();
-           i != information->attributes.end (); ++i)
+      if (FindAttribute (uid, name) != 0)
         {
-          if (i->name == name)
-            {
-              NS_LOG_LOGIC (IIDL << true);
-              return true;
-            }
+          NS_LOG_LOGIC (IIDL << true);
+          return true;
         }
-      struct IidInformation *parent = LookupInformation (information->parent);
-      if (parent == information)
+      uint16_t parent = GetParent (uid);
+      if (parent == uid)
         {
           // top of inheritance tree
           NS_LOG_LOGIC (IIDL << false);
           return false;
         }
       // check parent
-      information = parent;
+      uid = parent;
     }
   NS_LOG_LOGIC (IIDL << false);
   return false;
@@ -680,6 +696,7 @@ IidManager::AddAttribute (uint16_t uid,
   info.checker = checker;
   info.supportLevel = supportLevel;
   info.supportMsg = supportMsg;
+  information->attributeIndex[name] = information->attributes.size ();
   information->attributes.push_back (info);
   NS_LOG_LOGIC (IIDL << information->attributes.size () - 1);
 }
@@ -714,33 +731,40 @@ IidManager::GetAttribute (uint16_t uid, std::size_t i) const
   NS_LOG_LOGIC (IIDL << information->name);
   return information->attributes[i];
 }
+const struct TypeId::AttributeInformation *
+IidManager::FindAttribute (uint16_t uid, const std::string &name) const
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  struct IidInformation *information = LookupInformation (uid);
+  std::unordered_map<std::string, std::size_t>::const_iterator i = information->attributeIndex.find (name);
+  if (i == information->attributeIndex.end ())
+    {
+      return 0;
+    }
+  return &information->attributes[i->second];
+}
 
 bool
 IidManager::HasTraceSource (uint16_t uid,
                             std::string name)
 {
   NS_LOG_FUNCTION (IID << uid << name);
-  struct IidInformation *information  = LookupInformation (uid);
   while (true)
     {
-      for (std::vector<struct TypeId::TraceSourceInformation>::const_iterator i = information->traceSources.begin ();
-           i != information->traceSources.end (); ++i)
+      if (FindTraceSource (uid, name) != 0)
         {
-          if (i->name == name)
-            {
-              NS_LOG_LOGIC (IIDL << true);
-              return true;
-            }
+          NS_LOG_LOGIC (IIDL << true);
+          return true;
         }
-      struct IidInformation *parent = LookupInformation (information->parent);
-      if (parent == information)
+      uint16_t parent = GetParent (uid);
+      if (parent == uid)
         {
           // top of inheritance tree
           NS_LOG_LOGIC (IIDL << false);
           return false;
         }
       // check parent
-      information = parent;
+      uid = parent;
     }
   NS_LOG_LOGIC (IIDL << false);
   return false;
@@ -772,6 +796,7 @@ IidManager::AddTraceSource (uint16_t uid,
   source.callback = callback;
   source.supportLevel = supportLevel;
   source.supportMsg = supportMsg;
+  information->traceSourceIndex[name] = information->traceSources.size ();
   information->traceSources.push_back (source);
   NS_LOG_LOGIC (IIDL << information->traceSources.size () - 1);
 }
@@ -793,6 +818,18 @@ IidManager::GetTraceSource (uint16_t uid, std::size_t i) const
   NS_LOG_LOGIC (IIDL << information->name);
   return information->traceSources[i];
 }
+const struct TypeId::TraceSourceInformation *
+IidManager::FindTraceSource (uint16_t uid, const std::string &name) const
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  struct IidInformation *information = LookupInformation (uid);
+  std::unordered_map<std::string, std::size_t>::const_iterator i = information->traceSourceIndex.find (name);
+  if (i == information->traceSourceIndex.end ())
+    {
+      return 0;
+    }
+  return &information->traceSources[i->second];
+}
 bool
 IidManager::MustHideFromDocumentation (uint16_t uid) const
 {
@@ -883,37 +920,39 @@ bool
 TypeId::LookupAttributeByName (std::string name, struct TypeId::AttributeInformation *info) const
 {
   NS_LOG_FUNCTION (this << name << info);
-  TypeId tid;
-  TypeId nextTid = *this;
+  if (!FindAttributeByName (name, info))
+    {
+      return false;
+    }
+  if (info->supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "Attribute '" << name << "' is deprecated: "
+                << info->supportMsg << std::endl;
+    }
+  else if (info->supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("Attribute '" << name <<
+                      "' is obsolete, with no fallback: " <<
+                      info->supportMsg);
+    }
+  return true;
+}
+bool
+TypeId::FindAttributeByName (std::string name, struct TypeId::AttributeInformation *info) const
+{
+  NS_LOG_FUNCTION (this << name << info);
+  uint16_t tid;
+  uint16_t nextTid = m_tid;
   do
     {
       tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
+      const struct TypeId::AttributeInformation *found = IidManager::Get ()->FindAttribute (tid, name);
+      if (found != 0)
         {
-          struct TypeId::AttributeInformation tmp = tid.GetAttribute (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "Attribute '" << name << "' is deprecated: "
-                            << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("Attribute '" << name <<
-                                  "' is obsolete, with no fallback: " <<
-                                  tmp.supportMsg);
-                }
-            }
+          *info = *found;
+          return true;
         }
-      nextTid = tid.GetParent ();
+      nextTid = IidManager::Get ()->GetParent (tid);
     }
   while (nextTid != tid);
   return false;
@@ -1137,38 +1176,29 @@ TypeId::LookupTraceSourceByName (std::string name,
                                  struct TraceSourceInformation *info) const
 {
   NS_LOG_FUNCTION (this << name);
-  TypeId tid;
-  TypeId nextTid = *this;
-  struct TypeId::TraceSourceInformation tmp;
+  uint16_t tid;
+  uint16_t nextTid = m_tid;
   do
     {
       tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetTraceSourceN (); i++)
+      const struct TypeId::TraceSourceInformation *found = IidManager::Get ()->FindTraceSource (tid, name);
+      if (found != 0)
         {
-          tmp = tid.GetTraceSource (i);
-          if (tmp.name == name)
+          if (found->supportLevel == TypeId::DEPRECATED)
+            {
+              std::cerr << "TraceSource '" << name << "' is deprecated: "
+                        << found->supportMsg << std::endl;
+            }
+          else if (found->supportLevel == TypeId::OBSOLETE)
             {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "TraceSource '" << name << "' is deprecated: "
-                            << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("TraceSource '" << name <<
-                                  "' is obsolete, with no fallback: " <<
-                                  tmp.supportMsg);
-                }
+              NS_FATAL_ERROR ("TraceSource '" << name <<
+                              "' is obsolete, with no fallback: " <<
+                              found->supportMsg);
             }
+          *info = *found;
+          return found->accessor;
         }
-      nextTid = tid.GetParent ();
+      nextTid = IidManager::Get ()->GetParent (tid);
     }
   while (nextTid != tid);
   return 0;
@@ -472,6 +472,20 @@ public:
    * \returns \c true if the requested attribute could be found.
    */
   bool LookupAttributeByName (std::string name, struct AttributeInformation *info) const;
+  /**
+   * Find an Attribute by name, in this TypeId or in its parents,
+   * whatever its support level.
+   *
+   * Unlike LookupAttributeByName, this neither warns about deprecated
+   * attributes nor aborts on obsolete ones.
+   *
+   * \param [in]  name The name of the requested attribute
+   * \param [out] info A pointer to the TypeId::AttributeInformation
+   *              data structure where the result value of this method
+   *              will be stored.
+   * \returns \c true if the requested attribute could be found.
+   */
+  bool FindAttributeByName (std::string name, struct AttributeInformation *info) const;
   /**
    * Find a TraceSource by name.
    *
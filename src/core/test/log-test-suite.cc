@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/unused.h"
+#include <iostream>
+#include <sstream>
+
+// Only the errors are compiled in this file, see LogCompileMaskTestCase
+#undef NS3_LOG_COMPILE_MASK
+#define NS3_LOG_COMPILE_MASK (ns3::LOG_ERROR)
+
+/**
+ * \file
+ * \ingroup core-tests
+ * \ingroup logging
+ * \ingroup logging-tests
+ * Logging test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup logging-tests Logging test suite
+ */
+
+namespace ns3 {
+
+namespace tests {
+
+NS_LOG_COMPONENT_DEFINE ("LogTestSuite");
+
+
+/**
+ * \ingroup logging-tests
+ * LogRateLimiter test
+ */
+class LogRateLimiterTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  LogRateLimiterTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LogRateLimiterTestCase::LogRateLimiterTestCase ()
+  : TestCase ("Check that LogRateLimiter drops the messages past the burst")
+{}
+
+void
+LogRateLimiterTestCase::DoRun (void)
+{
+  // The burst is the rate; the next token comes half a second later,
+  // well after the loops below.
+  LogRateLimiter limiter (2);
+  NS_TEST_ASSERT_MSG_EQ (limiter.Allow (), true, "First message of the burst dropped");
+  NS_TEST_ASSERT_MSG_EQ (limiter.Allow (), true, "Second message of the burst dropped");
+
+  std::ostringstream none;
+  limiter.AppendSuppressed (none);
+  NS_TEST_ASSERT_MSG_EQ (none.str (), "", "Suppressed count printed while nothing was dropped");
+
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (limiter.Allow (), false, "Message " << i << " past the burst not dropped");
+    }
+
+  std::ostringstream dropped;
+  limiter.AppendSuppressed (dropped);
+  NS_TEST_ASSERT_MSG_EQ (dropped.str (), " [5 suppressed]", "Wrong suppressed count");
+
+  std::ostringstream reset;
+  limiter.AppendSuppressed (reset);
+  NS_TEST_ASSERT_MSG_EQ (reset.str (), "", "Suppressed count not reset once printed");
+}
+
+
+/**
+ * \ingroup logging-tests
+ * NS3_LOG_COMPILE_MASK test
+ */
+class LogCompileMaskTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  LogCompileMaskTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LogCompileMaskTestCase::LogCompileMaskTestCase ()
+  : TestCase ("Check that the levels outside NS3_LOG_COMPILE_MASK are not evaluated")
+{}
+
+void
+LogCompileMaskTestCase::DoRun (void)
+{
+  uint32_t debugEvaluations = 0;
+  uint32_t errorEvaluations = 0;
+  std::ostringstream log;
+  std::streambuf *clogBuf = std::clog.rdbuf (log.rdbuf ());
+  LogComponentEnable ("LogTestSuite", LOG_LEVEL_ALL);
+
+  NS_LOG_DEBUG ("debug " << ++debugEvaluations);
+  NS_LOG_ERROR ("error " << ++errorEvaluations);
+
+  LogComponentDisable ("LogTestSuite", LOG_LEVEL_ALL);
+  std::clog.rdbuf (clogBuf);
+
+  NS_TEST_ASSERT_MSG_EQ (debugEvaluations, 0, "Statement of a level masked out at compile time evaluated");
+  NS_UNUSED (errorEvaluations);
+#ifdef NS3_LOG_ENABLE
+  NS_TEST_ASSERT_MSG_EQ (errorEvaluations, 1, "Statement of a level compiled in not evaluated");
+  NS_TEST_ASSERT_MSG_EQ (log.str ().find ("debug"), std::string::npos, "Level masked out at compile time logged");
+  NS_TEST_ASSERT_MSG_NE (log.str ().find ("error 1"), std::string::npos, "Level compiled in not logged");
+#endif
+}
+
+
+/**
+ * \ingroup logging-tests
+ * Logging test suite
+ */
+class LogTestSuite : public TestSuite
+{
+public:
+  /** Constructor. */
+  LogTestSuite ()
+    : TestSuite ("log")
+  {
+    AddTestCase (new LogRateLimiterTestCase ());
+    AddTestCase (new LogCompileMaskTestCase ());
+  }
+};
+
+/**
+ * \ingroup logging-tests
+ * LogTestSuite instance variable.
+ */
+static LogTestSuite g_logTestSuite;
+
+
+}    // namespace tests
+
+}  // namespace ns3
@@ -151,10 +151,54 @@ protected:
   }
 };
 
+/**
+ * \ingroup object-tests
+ * Object which looks up the BaseA of its aggregate when it is destroyed.
+ */
+class LookupOnDestroy : public ns3::Object
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static ns3::TypeId GetTypeId (void)
+  {
+    static ns3::TypeId tid = ns3::TypeId ("ObjectTest:LookupOnDestroy")
+      .SetParent<Object> ()
+      .SetGroupName ("Core")
+      .HideFromDocumentation ()
+      .AddConstructor<LookupOnDestroy> ();
+    return tid;
+  }
+  /** Constructor. */
+  LookupOnDestroy ()
+  {}
+  /** Destructor. */
+  virtual ~LookupOnDestroy ()
+  {
+    // The whole aggregate is being deleted, so no reference is left and
+    // GetObject would assert: take one, which is never released since
+    // this object goes away anyway.
+    Ref ();
+    s_destroyed = true;
+    s_foundBaseA = (GetObject<BaseA> () != 0);
+  }
+
+  /** Whether a LookupOnDestroy has been destroyed. */
+  static bool s_destroyed;
+  /** Whether the last LookupOnDestroy destroyed found a BaseA. */
+  static bool s_foundBaseA;
+};
+
+bool LookupOnDestroy::s_destroyed = false;
+bool LookupOnDestroy::s_foundBaseA = false;
+
 NS_OBJECT_ENSURE_REGISTERED (BaseA);
 NS_OBJECT_ENSURE_REGISTERED (DerivedA);
 NS_OBJECT_ENSURE_REGISTERED (BaseB);
 NS_OBJECT_ENSURE_REGISTERED (DerivedB);
+NS_OBJECT_ENSURE_REGISTERED (LookupOnDestroy);
 
 }  // unnamed namespace
 
@@ -402,6 +446,123 @@ AggregateObjectTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_NE (baseA, 0, "Unable to GetObject on released object");
 }
 
+/**
+ * \ingroup object-tests
+ * Test the cache of aggregate lookups does not outlive the aggregate.
+ */
+class AggregateCacheTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  AggregateCacheTestCase ();
+  /** Destructor. */
+  virtual ~AggregateCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+AggregateCacheTestCase::AggregateCacheTestCase ()
+  : TestCase ("Check the aggregate lookup cache")
+{}
+
+AggregateCacheTestCase::~AggregateCacheTestCase ()
+{}
+
+void
+AggregateCacheTestCase::DoRun (void)
+{
+  Ptr<BaseA> baseA = CreateObject<BaseA> ();
+  Ptr<BaseB> baseB = CreateObject<BaseB> ();
+  baseA->AggregateObject (baseB);
+
+  //
+  // Cache the lookups of both parts of the aggregation.  The first object of
+  // the aggregate is found without the cache, so look up the other one first.
+  //
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), baseB, "Cannot GetObject (through baseA) for BaseB Object");
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseA> (), baseA, "Cannot GetObject (through baseA) for BaseA Object");
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<LookupOnDestroy> (), 0, "Unexpectedly found a LookupOnDestroy through baseA");
+
+  //
+  // Aggregating a new type builds a new aggregate: the lookups cached in the
+  // old one must still give the same objects, and the new type must be found.
+  //
+  Ptr<LookupOnDestroy> lookup = CreateObject<LookupOnDestroy> ();
+  baseA->AggregateObject (lookup);
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseA> (), baseA, "Cannot GetObject (through baseA) for BaseA Object after AggregateObject");
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), baseB, "Cannot GetObject (through baseA) for BaseB Object after AggregateObject");
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<LookupOnDestroy> (), lookup, "Cannot GetObject (through baseA) for LookupOnDestroy Object");
+  NS_TEST_ASSERT_MSG_EQ (lookup->GetObject<BaseA> (), baseA, "Cannot GetObject (through lookup) for BaseA Object");
+  NS_TEST_ASSERT_MSG_EQ (lookup->GetObject<BaseB> (), baseB, "Cannot GetObject (through lookup) for BaseB Object");
+
+  //
+  // Cache a lookup of a BaseA, then destroy the aggregate.  The BaseA is
+  // deleted first, as it was the most looked up, so the cache must not give
+  // it back to the LookupOnDestroy deleted after it.
+  //
+  baseB = 0;
+  lookup = CreateObject<LookupOnDestroy> ();
+  baseA = CreateObject<BaseA> ();
+  lookup->AggregateObject (baseA);
+  NS_TEST_ASSERT_MSG_EQ (lookup->GetObject<BaseA> (), baseA, "Cannot GetObject (through lookup) for BaseA Object");
+  LookupOnDestroy::s_destroyed = false;
+  baseA = 0;
+  lookup = 0;
+  NS_TEST_ASSERT_MSG_EQ (LookupOnDestroy::s_destroyed, true, "LookupOnDestroy not destroyed with its aggregate");
+  NS_TEST_ASSERT_MSG_EQ (LookupOnDestroy::s_foundBaseA, false, "Found a BaseA already destroyed");
+}
+
+/**
+ * \ingroup object-tests
+ * Test the assignment of Objects leaves their aggregates apart.
+ */
+class ObjectAssignmentTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  ObjectAssignmentTestCase ();
+  /** Destructor. */
+  virtual ~ObjectAssignmentTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ObjectAssignmentTestCase::ObjectAssignmentTestCase ()
+  : TestCase ("Check Object assignment")
+{}
+
+ObjectAssignmentTestCase::~ObjectAssignmentTestCase ()
+{}
+
+void
+ObjectAssignmentTestCase::DoRun (void)
+{
+  Ptr<BaseA> baseA = CreateObject<BaseA> ();
+  Ptr<BaseB> baseB = CreateObject<BaseB> ();
+  baseA->AggregateObject (baseB);
+
+  //
+  // Assign by value, as done with the component carrier maps of the mmWave
+  // helpers.  The copy stays alone in its own aggregate.
+  //
+  Ptr<BaseA> copy = CreateObject<BaseA> ();
+  *copy = *baseA;
+  NS_TEST_ASSERT_MSG_EQ (copy->GetObject<BaseA> (), copy, "GetObject (through copy) for BaseA returns different Ptr");
+  NS_TEST_ASSERT_MSG_EQ (copy->GetObject<BaseB> (), 0, "Unexpectedly found a BaseB through copy");
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), baseB, "Cannot GetObject (through baseA) for BaseB Object");
+  NS_TEST_ASSERT_MSG_EQ (baseB->GetObject<BaseA> (), baseA, "GetObject (through baseB) for BaseA returns the copy");
+
+  //
+  // Deleting the source aggregate must leave the copy usable.
+  //
+  baseA = 0;
+  baseB = 0;
+  NS_TEST_ASSERT_MSG_EQ (copy->GetObject<BaseA> (), copy, "GetObject (through copy) for BaseA fails once the source is deleted");
+  NS_TEST_ASSERT_MSG_EQ (copy->GetObject<BaseB> (), 0, "Unexpectedly found a BaseB through copy once the source is deleted");
+}
+
 /**
  * \ingroup object-tests
  * Test an Object factory can create Objects
@@ -491,6 +652,8 @@ ObjectTestSuite::ObjectTestSuite ()
 {
   AddTestCase (new CreateObjectTestCase);
   AddTestCase (new AggregateObjectTestCase);
+  AddTestCase (new AggregateCacheTestCase);
+  AddTestCase (new ObjectAssignmentTestCase);
   AddTestCase (new ObjectFactoryTestCase);
 }
 
@@ -2434,6 +2434,94 @@ NormalCachingTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_GT (v2, 0, "Incorrect value returned, expected > 0");
 }
 
+/**
+ * Test case for the bulk GetValues of the Uniform, Normal and Exponential
+ * RVs, which must return the same values as repeated GetValue calls.
+ */
+class BulkTestCase : public TestCaseBase
+{
+public:
+  // Constructor
+  BulkTestCase ();
+
+private:
+  // Inherited
+  virtual void DoRun (void);
+
+  /**
+   * Check that two streams configured alike return the same values,
+   * one through GetValues and one through GetValue.
+   * \param [in] bulk The RV drawn with GetValues.
+   * \param [in] scalar The RV drawn with GetValue.
+   * \param [in] name The RV name, for the messages.
+   */
+  template <typename RV>
+  void CheckSequence (Ptr<RV> bulk, Ptr<RV> scalar, std::string name);
+};
+
+BulkTestCase::BulkTestCase ()
+  : TestCaseBase ("Bulk GetValues matches GetValue")
+{}
+
+template <typename RV>
+void
+BulkTestCase::CheckSequence (Ptr<RV> bulk, Ptr<RV> scalar, std::string name)
+{
+  // odd sizes, so that the Normal RV keeps half a pair between calls
+  const std::size_t sizes[] = {1, 7, 0, 64, 3};
+  for (std::size_t s = 0; s < sizeof (sizes) / sizeof (sizes[0]); s++)
+    {
+      std::vector<double> values (sizes[s] + 1);
+      bulk->GetValues (values.data (), sizes[s]);
+      for (std::size_t i = 0; i < sizes[s]; i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (values[i], scalar->GetValue (),
+                                 name << " value " << i << " of batch " << s << " differs");
+        }
+    }
+}
+
+void
+BulkTestCase::DoRun (void)
+{
+  NS_LOG_FUNCTION (this);
+  SetTestSuiteSeed ();
+
+  for (int antithetic = 0; antithetic < 2; antithetic++)
+    {
+      Ptr<UniformRandomVariable> u1 = CreateObject<UniformRandomVariable> ();
+      Ptr<UniformRandomVariable> u2 = CreateObject<UniformRandomVariable> ();
+      Ptr<NormalRandomVariable> n1 = CreateObject<NormalRandomVariable> ();
+      Ptr<NormalRandomVariable> n2 = CreateObject<NormalRandomVariable> ();
+      Ptr<ExponentialRandomVariable> e1 = CreateObject<ExponentialRandomVariable> ();
+      Ptr<ExponentialRandomVariable> e2 = CreateObject<ExponentialRandomVariable> ();
+      u1->SetStream (1);
+      u2->SetStream (1);
+      n1->SetStream (2);
+      n2->SetStream (2);
+      e1->SetStream (3);
+      e2->SetStream (3);
+      u1->SetAttribute ("Min", DoubleValue (-3));
+      u2->SetAttribute ("Min", DoubleValue (-3));
+      n1->SetAttribute ("Variance", DoubleValue (4));
+      n2->SetAttribute ("Variance", DoubleValue (4));
+      n1->SetAttribute ("Bound", DoubleValue (3));
+      n2->SetAttribute ("Bound", DoubleValue (3));
+      e1->SetAttribute ("Bound", DoubleValue (2));
+      e2->SetAttribute ("Bound", DoubleValue (2));
+      u1->SetAntithetic (antithetic);
+      u2->SetAntithetic (antithetic);
+      n1->SetAntithetic (antithetic);
+      n2->SetAntithetic (antithetic);
+      e1->SetAntithetic (antithetic);
+      e2->SetAntithetic (antithetic);
+
+      CheckSequence (u1, u2, "Uniform");
+      CheckSequence (n1, n2, "Normal");
+      CheckSequence (e1, e2, "Exponential");
+    }
+}
+
 /**
  * RandomVariableStream test suite, covering all random number variable
  * stream generator types.
@@ -2485,6 +2573,7 @@ RandomVariableSuite::RandomVariableSuite ()
   AddTestCase (new EmpiricalAntitheticTestCase);
   /// Issue #302:  NormalRandomVariable produces stale values
   AddTestCase (new NormalCachingTestCase);
+  AddTestCase (new BulkTestCase);
 }
 
 static RandomVariableSuite randomVariableSuite;
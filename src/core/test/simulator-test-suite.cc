@@ -24,6 +24,10 @@
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/string.h"
+#include <fstream>
+#include <string>
 
 using namespace ns3;
 
@@ -465,6 +469,71 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SimulatorProfileTestCase : public TestCase
+{
+public:
+  SimulatorProfileTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SimulatorProfileTestCase::SimulatorProfileTestCase ()
+  : TestCase ("Check the event profile of DefaultSimulatorImpl")
+{}
+
+void
+SimulatorProfileTestCase::DoRun (void)
+{
+  std::string profileFile = CreateTempDirFilename ("profile.txt");
+  ObjectFactory factory ("ns3::DefaultSimulatorImpl");
+  factory.Set ("ProfileFile", StringValue (profileFile));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+
+  // two event types, run in three contexts
+  Simulator::Schedule (MicroSeconds (1), &foo0);
+  Simulator::Schedule (MicroSeconds (2), &foo0);
+  Simulator::ScheduleWithContext (1, MicroSeconds (3), &foo0);
+  Simulator::ScheduleWithContext (1, MicroSeconds (4), &foo1, 0);
+  Simulator::ScheduleWithContext (2, MicroSeconds (5), &foo1, 0);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  std::ifstream report (profileFile.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (report.is_open (), true, "No profile written to " << profileFile);
+  std::string name;
+  std::string unit;
+  uint64_t count = 0;
+  double ms;
+  report >> name >> count >> unit >> ms;
+  NS_TEST_EXPECT_MSG_EQ (name, "events", "Unexpected first line of the profile");
+  NS_TEST_EXPECT_MSG_EQ (count, 5, "Wrong number of events profiled");
+  std::string op;
+  report >> name >> op >> count >> unit >> ms;
+  NS_TEST_EXPECT_MSG_EQ (name + " " + op, "scheduler insert", "Unexpected second line of the profile");
+  NS_TEST_EXPECT_MSG_EQ (count, 5, "Wrong number of scheduler inserts");
+  report >> name >> op >> count >> unit >> ms;
+  NS_TEST_EXPECT_MSG_EQ (name + " " + op, "scheduler remove", "Unexpected third line of the profile");
+  NS_TEST_EXPECT_MSG_EQ (count, 5, "Wrong number of scheduler removes");
+
+  // one line for each of (no context, foo0), (1, foo0), (1, foo1) and (2, foo1)
+  std::ifstream folded ((profileFile + ".folded").c_str ());
+  NS_TEST_ASSERT_MSG_EQ (folded.is_open (), true, "No folded profile written");
+  std::string line;
+  uint32_t lines = 0;
+  uint32_t noContext = 0;
+  while (std::getline (folded, line))
+    {
+      lines++;
+      if (line.compare (0, 11, "no context;") == 0)
+        {
+          noContext++;
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (lines, 4, "Wrong number of context/type pairs in the folded profile");
+  NS_TEST_EXPECT_MSG_EQ (noContext, 1, "Wrong number of event types without context");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -483,5 +552,6 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (PriorityQueueScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SimulatorProfileTestCase (), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
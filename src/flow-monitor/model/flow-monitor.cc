@@ -22,6 +22,7 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/double.h"
+#include "ns3/string.h"
 #include <fstream>
 #include <sstream>
 
@@ -69,6 +70,15 @@ FlowMonitor::GetTypeId (void)
                    TimeValue (Seconds (0.5)),
                    MakeTimeAccessor (&FlowMonitor::m_flowInterruptionsMinTime),
                    MakeTimeChecker ())
+    .AddAttribute ("StatsExportInterval", ("If positive, the counters of every flow are appended "
+                                           "to StatsExportFileName with this period, in CSV format."),
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&FlowMonitor::m_statsExportInterval),
+                   MakeTimeChecker ())
+    .AddAttribute ("StatsExportFileName", ("The name of the file of the periodic flow stats export."),
+                   StringValue ("flow-stats.csv"),
+                   MakeStringAccessor (&FlowMonitor::m_statsExportFileName),
+                   MakeStringChecker ())
   ;
   return tid;
 }
@@ -91,6 +101,8 @@ FlowMonitor::DoDispose (void)
   NS_LOG_FUNCTION (this);
   Simulator::Cancel (m_startEvent);
   Simulator::Cancel (m_stopEvent);
+  Simulator::Cancel (m_statsExportEvent);
+  m_statsExportStream = 0;
   for (std::list<Ptr<FlowClassifier> >::iterator iter = m_classifiers.begin ();
       iter != m_classifiers.end ();
       iter ++)
@@ -343,6 +355,24 @@ FlowMonitor::NotifyConstructionCompleted ()
 {
   Object::NotifyConstructionCompleted ();
   Simulator::Schedule (PERIODIC_CHECK_INTERVAL, &FlowMonitor::PeriodicCheckForLostPackets, this);
+  if (m_statsExportInterval.IsStrictlyPositive ())
+    {
+      m_statsExportEvent = Simulator::Schedule (m_statsExportInterval, &FlowMonitor::PeriodicExportFlowStats, this);
+    }
+}
+
+void
+FlowMonitor::PeriodicExportFlowStats ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_statsExportStream == 0)
+    {
+      m_statsExportStream = Create<OutputStreamWrapper> (m_statsExportFileName, std::ios::out);
+      *m_statsExportStream->GetStream () << "time,flowId,txPackets,txBytes,rxPackets,rxBytes,"
+                                         << "lostPackets,timesForwarded,delaySum,jitterSum\n";
+    }
+  SerializeToCsvStream (*m_statsExportStream->GetStream ());
+  m_statsExportEvent = Simulator::Schedule (m_statsExportInterval, &FlowMonitor::PeriodicExportFlowStats, this);
 }
 
 void
@@ -520,6 +550,31 @@ FlowMonitor::SerializeToXmlFile (std::string fileName, bool enableHistograms, bo
   os.close ();
 }
 
+void
+FlowMonitor::SerializeToCsvStream (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this);
+  double now = Simulator::Now ().GetSeconds ();
+  // times to the nanosecond, whatever their magnitude
+  std::ios_base::fmtflags oldFlags = os.flags ();
+  std::streamsize oldPrecision = os.precision (9);
+  os.setf (std::ios_base::fixed, std::ios_base::floatfield);
+  for (FlowStatsContainerCI flowI = m_flowStats.begin ();
+       flowI != m_flowStats.end (); flowI++)
+    {
+      const FlowStats &stats = flowI->second;
+      os << now << ',' << flowI->first
+         << ',' << stats.txPackets << ',' << stats.txBytes
+         << ',' << stats.rxPackets << ',' << stats.rxBytes
+         << ',' << stats.lostPackets << ',' << stats.timesForwarded
+         << ',' << stats.delaySum.GetSeconds () << ',' << stats.jitterSum.GetSeconds ()
+         << '\n';
+    }
+  os.flags (oldFlags);
+  os.precision (oldPrecision);
+}
+
+
 
 } // namespace ns3
 
@@ -23,6 +23,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "ns3/ptr.h"
 #include "ns3/object.h"
@@ -31,6 +32,7 @@
 #include "ns3/histogram.h"
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
+#include "ns3/output-stream-wrapper.h"
 
 namespace ns3 {
 
@@ -258,6 +260,15 @@ public:
   /// \param enableProbes if true, include also the per-probe/flow pair statistics in the output
   void SerializeToXmlFile (std::string fileName, bool enableHistograms, bool enableProbes);
 
+  /// Writes the counters of every flow to an std::ostream, one comma
+  /// separated line per flow, prefixed by the current simulation time.
+  /// The columns are: time, flowId, txPackets, txBytes, rxPackets,
+  /// rxBytes, lostPackets, timesForwarded, delaySum and jitterSum, with
+  /// times in seconds, written with nine decimals.  This is the format used by the periodic export
+  /// enabled with the StatsExportInterval attribute.
+  /// \param os the output stream
+  void SerializeToCsvStream (std::ostream &os) const;
+
 
 protected:
 
@@ -277,8 +288,19 @@ private:
   /// FlowId --> FlowStats
   FlowStatsContainer m_flowStats;
 
+  /// Hash function for the (FlowId,PacketId) pairs
+  struct TrackedPacketKeyHash
+  {
+    /// \param key the (FlowId,PacketId) pair
+    /// \return the hash of the pair
+    std::size_t operator() (const std::pair<FlowId, FlowPacketId> &key) const
+    {
+      return std::hash<uint64_t> () ((static_cast<uint64_t> (key.first) << 32) | key.second);
+    }
+  };
+
   /// (FlowId,PacketId) --> TrackedPacket
-  typedef std::map< std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
+  typedef std::unordered_map< std::pair<FlowId, FlowPacketId>, TrackedPacket, TrackedPacketKeyHash> TrackedPacketMap;
   TrackedPacketMap m_trackedPackets; //!< Tracked packets
   Time m_maxPerHopDelay; //!< Minimum per-hop delay
   FlowProbeContainer m_flowProbes; //!< all the FlowProbes
@@ -294,6 +316,10 @@ private:
   double m_packetSizeBinWidth;  //!< packet size bin width (for histograms)
   double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
   Time m_flowInterruptionsMinTime; //!< Flow interruptions minimum time
+  Time m_statsExportInterval; //!< Period of the flow stats export, zero to disable it
+  std::string m_statsExportFileName; //!< Name of the file of the flow stats export
+  Ptr<OutputStreamWrapper> m_statsExportStream; //!< Stream of the flow stats export
+  EventId m_statsExportEvent; //!< Next flow stats export
 
   /// Get the stats for a given flow
   /// \param flowId the Flow identification
@@ -302,6 +328,9 @@ private:
 
   /// Periodic function to check for lost packets and prune statistics
   void PeriodicCheckForLostPackets ();
+
+  /// Periodic function to append the flow counters to the export file
+  void PeriodicExportFlowStats ();
 };
 
 
@@ -148,44 +148,47 @@ Ipv4FlowClassifier::Classify (const Ipv4Header &ipHeader, Ptr<const Packet> ipPa
   tuple.destinationPort = dstPort;
 
   // try to insert the tuple, but check if it already exists
-  std::pair<std::map<FiveTuple, FlowId>::iterator, bool> insert
+  std::pair<std::unordered_map<FiveTuple, FlowId, FiveTupleHash>::iterator, bool> insert
     = m_flowMap.insert (std::pair<FiveTuple, FlowId> (tuple, 0));
 
   // if the insertion succeeded, we need to assign this tuple a new flow identifier
   if (insert.second)
     {
-      FlowId newFlowId = GetNewFlowId ();
-      insert.first->second = newFlowId;
-      m_flowPktIdMap[newFlowId] = 0;
-      m_flowDscpMap[newFlowId];
+      insert.first->second = GetNewFlowId ();
     }
-  else
+  FlowId flowId = insert.first->second;
+
+  // the first packet of a flow gets the packet identifier 0
+  FlowPacketId &packetId = m_flowPktIdMap[flowId];
+  if (!insert.second)
     {
-      m_flowPktIdMap[insert.first->second] ++;
+      packetId++;
     }
 
   // increment the counter of packets with the same DSCP value
-  Ipv4Header::DscpType dscp = ipHeader.GetDscp ();
-  std::pair<std::map<Ipv4Header::DscpType, uint32_t>::iterator, bool> dscpInserter
-    = m_flowDscpMap[insert.first->second].insert (std::pair<Ipv4Header::DscpType, uint32_t> (dscp, 1));
+  ++m_flowDscpMap[flowId][ipHeader.GetDscp ()];
 
-  // if the insertion did not succeed, we need to increment the counter
-  if (!dscpInserter.second)
-    {
-      m_flowDscpMap[insert.first->second][dscp] ++;
-    }
-
-  *out_flowId = insert.first->second;
-  *out_packetId = m_flowPktIdMap[*out_flowId];
+  *out_flowId = flowId;
+  *out_packetId = packetId;
 
   return true;
 }
 
 
+std::size_t
+Ipv4FlowClassifier::FiveTupleHash::operator() (const FiveTuple &tuple) const
+{
+  std::size_t h = Ipv4AddressHash () (tuple.sourceAddress);
+  h = h * 31 + Ipv4AddressHash () (tuple.destinationAddress);
+  h = h * 31 + tuple.protocol;
+  h = h * 31 + ((static_cast<uint32_t> (tuple.sourcePort) << 16) | tuple.destinationPort);
+  return h;
+}
+
 Ipv4FlowClassifier::FiveTuple
 Ipv4FlowClassifier::FindFlow (FlowId flowId) const
 {
-  for (std::map<FiveTuple, FlowId>::const_iterator
+  for (std::unordered_map<FiveTuple, FlowId, FiveTupleHash>::const_iterator
        iter = m_flowMap.begin (); iter != m_flowMap.end (); iter++)
     {
       if (iter->second == flowId)
@@ -208,7 +211,7 @@ Ipv4FlowClassifier::SortByCount::operator() (std::pair<Ipv4Header::DscpType, uin
 std::vector<std::pair<Ipv4Header::DscpType, uint32_t> >
 Ipv4FlowClassifier::GetDscpCounts (FlowId flowId) const
 {
-  std::map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> >::const_iterator flow
+  std::unordered_map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> >::const_iterator flow
     = m_flowDscpMap.find (flowId);
 
   if (flow == m_flowDscpMap.end ())
@@ -226,9 +229,12 @@ Ipv4FlowClassifier::SerializeToXmlStream (std::ostream &os, uint16_t indent) con
 {
   Indent (os, indent); os << "<Ipv4FlowClassifier>\n";
 
+  // the flows are hashed, sort them for a stable output
+  std::map<FiveTuple, FlowId> flows (m_flowMap.begin (), m_flowMap.end ());
+
   indent += 2;
   for (std::map<FiveTuple, FlowId>::const_iterator
-       iter = m_flowMap.begin (); iter != m_flowMap.end (); iter++)
+       iter = flows.begin (); iter != flows.end (); iter++)
     {
       Indent (os, indent);
       os << "<Flow flowId=\"" << iter->second << "\""
@@ -239,7 +245,7 @@ Ipv4FlowClassifier::SerializeToXmlStream (std::ostream &os, uint16_t indent) con
          << " destinationPort=\"" << iter->first.destinationPort << "\">\n";
 
       indent += 2;
-      std::map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> >::const_iterator flow
+      std::unordered_map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> >::const_iterator flow
         = m_flowDscpMap.find (iter->second);
 
       if (flow != m_flowDscpMap.end ())
@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 #include <map>
+#include <unordered_map>
 
 #include "ns3/ipv4-header.h"
 #include "ns3/flow-classifier.h"
@@ -49,6 +50,14 @@ public:
     uint16_t destinationPort;       //!< Destination port
   };
 
+  /// Hash function for the FiveTuple
+  struct FiveTupleHash
+  {
+    /// \param tuple the FiveTuple
+    /// \return the hash of the tuple
+    std::size_t operator() (const FiveTuple &tuple) const;
+  };
+
   Ipv4FlowClassifier ();
 
   /// \brief try to classify the packet into flow-id and packet-id
@@ -93,11 +102,11 @@ public:
 private:
 
   /// Map to Flows Identifiers to FlowIds
-  std::map<FiveTuple, FlowId> m_flowMap;
+  std::unordered_map<FiveTuple, FlowId, FiveTupleHash> m_flowMap;
   /// Map to FlowIds to FlowPacketId
-  std::map<FlowId, FlowPacketId> m_flowPktIdMap;
+  std::unordered_map<FlowId, FlowPacketId> m_flowPktIdMap;
   /// Map FlowIds to (DSCP value, packet count) pairs
-  std::map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> > m_flowDscpMap;
+  std::unordered_map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> > m_flowDscpMap;
 
 };
 
@@ -0,0 +1,128 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation;
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include <fstream>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief Probe reporting the packets of the test by hand.
+ */
+class CsvTestFlowProbe : public FlowProbe
+{
+public:
+  /**
+   * Constructor
+   * \param monitor the FlowMonitor this probe is associated with
+   */
+  CsvTestFlowProbe (Ptr<FlowMonitor> monitor)
+    : FlowProbe (monitor)
+  {
+  }
+};
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief FlowMonitor CSV export Test
+ */
+class FlowMonitorCsvTestCase : public TestCase
+{
+public:
+  FlowMonitorCsvTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+FlowMonitorCsvTestCase::FlowMonitorCsvTestCase ()
+  : TestCase ("FlowMonitor CSV export")
+{
+}
+
+void
+FlowMonitorCsvTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("flow-stats.csv");
+  Ptr<FlowMonitor> monitor = CreateObjectWithAttributes<FlowMonitor> (
+      "StatsExportInterval", TimeValue (Seconds (2)),
+      "StatsExportFileName", StringValue (fileName));
+  Ptr<FlowProbe> probe = Create<CsvTestFlowProbe> (monitor);
+  monitor->StartRightNow ();
+
+  // two packets of flow 1, with delays that need more than six
+  // significant digits
+  Simulator::Schedule (MilliSeconds (100), &FlowMonitor::ReportFirstTx, monitor, probe, 1, 1, 100);
+  Simulator::Schedule (NanoSeconds (1334567891), &FlowMonitor::ReportLastRx, monitor, probe, 1, 1, 100);
+  Simulator::Schedule (MilliSeconds (200), &FlowMonitor::ReportFirstTx, monitor, probe, 1, 2, 100);
+  Simulator::Schedule (MilliSeconds (700), &FlowMonitor::ReportLastRx, monitor, probe, 1, 2, 100);
+  Simulator::Stop (MilliSeconds (2500));
+  Simulator::Run ();
+
+  std::ostringstream os;
+  monitor->SerializeToCsvStream (os);
+  NS_TEST_ASSERT_MSG_EQ (os.str (), "2.500000000,1,2,200,2,200,0,0,1.734567891,0.734567891\n",
+                         "Wrong CSV line");
+  os << 0.5;
+  NS_TEST_ASSERT_MSG_EQ (os.str ().substr (os.str ().size () - 3), "0.5",
+                         "Stream format not restored");
+
+  // closes the periodic export file
+  monitor->Dispose ();
+  Simulator::Destroy ();
+
+  std::ifstream csv (fileName.c_str ());
+  std::string line;
+  std::getline (csv, line);
+  NS_TEST_ASSERT_MSG_EQ (line, "time,flowId,txPackets,txBytes,rxPackets,rxBytes,"
+                         "lostPackets,timesForwarded,delaySum,jitterSum", "Wrong CSV header");
+  std::getline (csv, line);
+  NS_TEST_ASSERT_MSG_EQ (line, "2.000000000,1,2,200,2,200,0,0,1.734567891,0.734567891",
+                         "Wrong periodic export line");
+  NS_TEST_ASSERT_MSG_EQ (std::getline (csv, line).good (), false, "Export written more than once");
+}
+
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief FlowMonitor CSV export TestSuite
+ */
+class FlowMonitorCsvTestSuite : public TestSuite
+{
+public:
+  FlowMonitorCsvTestSuite ();
+};
+
+FlowMonitorCsvTestSuite::FlowMonitorCsvTestSuite ()
+  : TestSuite ("flow-monitor-csv", UNIT)
+{
+  AddTestCase (new FlowMonitorCsvTestCase, TestCase::QUICK);
+}
+
+static FlowMonitorCsvTestSuite g_flowMonitorCsvTestSuite; //!< Static variable for test initialization
@@ -151,6 +151,9 @@ Ipv4EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (localAddress, localPort);
   endPoint->SetPeer (peerAddress, peerPort);
   m_endPoints.push_back (endPoint);
+  // the tuple is no longer unique, so it can no longer be cached
+  ConnectedKey key = {localAddress, peerAddress, localPort, peerPort};
+  m_connected.erase (key);
 
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
 
@@ -165,6 +168,25 @@ Ipv4EndPointDemux::DeAllocate (Ipv4EndPoint *endPoint)
     {
       if (*i == endPoint)
         {
+          ConnectedKey key = {endPoint->GetLocalAddress (), endPoint->GetPeerAddress (),
+                              endPoint->GetLocalPort (), endPoint->GetPeerPort ()};
+          ConnectedEndPoints::iterator it = m_connected.find (key);
+          if (it != m_connected.end () && it->second == endPoint)
+            {
+              m_connected.erase (it);
+            }
+          else
+            {
+              // the addresses may have changed since the entry was stored
+              for (it = m_connected.begin (); it != m_connected.end (); ++it)
+                {
+                  if (it->second == endPoint)
+                    {
+                      m_connected.erase (it);
+                      break;
+                    }
+                }
+            }
           delete endPoint;
           m_endPoints.erase (i);
           break;
@@ -201,17 +223,32 @@ Ipv4EndPointDemux::Lookup (Ipv4Address daddr, uint16_t dport,
                            Ptr<Ipv4Interface> incomingInterface)
 {
   NS_LOG_FUNCTION (this << daddr << dport << saddr << sport << incomingInterface);
-  
+
+  ConnectedKey key = {daddr, saddr, dport, sport};
+  Ipv4EndPoint *connected = LookupConnected (key, incomingInterface);
+  if (connected != 0)
+    {
+      NS_LOG_LOGIC ("Found a cached endpoint for case 4 " << connected->GetLocalAddress () << ":" << connected->GetLocalPort ());
+      return EndPoints (1, connected);
+    }
+
   EndPoints retval1; // Matches exact on local port, wildcards on others
   EndPoints retval2; // Matches exact on local port/adder, wildcards on others
   EndPoints retval3; // Matches all but local address
   EndPoints retval4; // Exact match on all 4
+  uint32_t nTuple = 0; // Endpoints with the same four-tuple, whatever their state
 
   NS_LOG_DEBUG ("Looking up endpoint for destination address " << daddr << ":" << dport);
   for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++) 
     {
       Ipv4EndPoint* endP = *i;
 
+      if (endP->GetLocalPort () == dport && endP->GetPeerPort () == sport
+          && endP->GetLocalAddress () == daddr && endP->GetPeerAddress () == saddr)
+        {
+          nTuple++;
+        }
+
       NS_LOG_DEBUG ("Looking at endpoint dport=" << endP->GetLocalPort ()
                                                  << " daddr=" << endP->GetLocalAddress ()
                                                  << " sport=" << endP->GetPeerPort ()
@@ -326,6 +363,10 @@ Ipv4EndPointDemux::Lookup (Ipv4Address daddr, uint16_t dport,
 
   // Here we find the most exact match
   EndPoints retval;
+  if (retval4.size () == 1 && nTuple == 1)
+    {
+      m_connected[key] = retval4.front ();
+    }
   if (!retval4.empty ()) retval = retval4;
   else if (!retval3.empty ()) retval = retval3;
   else if (!retval2.empty ()) retval = retval2;
@@ -335,6 +376,33 @@ Ipv4EndPointDemux::Lookup (Ipv4Address daddr, uint16_t dport,
   return retval;  // might be empty if no matches
 }
 
+Ipv4EndPoint *
+Ipv4EndPointDemux::LookupConnected (const ConnectedKey &key, Ptr<Ipv4Interface> incomingInterface)
+{
+  ConnectedEndPoints::iterator it = m_connected.find (key);
+  if (it == m_connected.end ())
+    {
+      return 0;
+    }
+  Ipv4EndPoint *endP = it->second;
+  if (endP->GetLocalPort () != key.localPort
+      || endP->GetLocalAddress () != key.localAddress
+      || endP->GetPeerPort () != key.peerPort
+      || endP->GetPeerAddress () != key.peerAddress)
+    {
+      NS_LOG_LOGIC ("Dropping stale cached endpoint " << endP);
+      m_connected.erase (it);
+      return 0;
+    }
+  if (!endP->IsRxEnabled ()
+      || (endP->GetBoundNetDevice () && endP->GetBoundNetDevice () != incomingInterface->GetDevice ()))
+    {
+      // let the full lookup decide
+      return 0;
+    }
+  return endP;
+}
+
 Ipv4EndPoint *
 Ipv4EndPointDemux::SimpleLookup (Ipv4Address daddr, 
                                  uint16_t dport, 
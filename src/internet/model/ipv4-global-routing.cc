@@ -80,6 +80,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, nextHop, interface);
   m_hostRoutes.push_back (route);
+  m_hostRoutesIndex[dest].push_back (--m_hostRoutes.end ());
 }
 
 void 
@@ -90,6 +91,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, interface);
   m_hostRoutes.push_back (route);
+  m_hostRoutesIndex[dest].push_back (--m_hostRoutes.end ());
 }
 
 void 
@@ -136,6 +138,26 @@ Ipv4GlobalRouting::AddASExternalRouteTo (Ipv4Address network,
 }
 
 
+void
+Ipv4GlobalRouting::UnindexHostRoute (HostRoutesI route)
+{
+  HostRoutesIndex::iterator it = m_hostRoutesIndex.find ((*route)->GetDest ());
+  NS_ASSERT (it != m_hostRoutesIndex.end ());
+  std::vector<HostRoutesI> &routes = it->second;
+  for (std::vector<HostRoutesI>::iterator i = routes.begin (); i != routes.end (); i++)
+    {
+      if (*i == route)
+        {
+          routes.erase (i);
+          break;
+        }
+    }
+  if (routes.empty ())
+    {
+      m_hostRoutesIndex.erase (it);
+    }
+}
+
 Ptr<Ipv4Route>
 Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
 {
@@ -147,23 +169,25 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
   RouteVec_t allRoutes;
 
   NS_LOG_LOGIC ("Number of m_hostRoutes = " << m_hostRoutes.size ());
-  for (HostRoutesCI i = m_hostRoutes.begin (); 
-       i != m_hostRoutes.end (); 
-       i++) 
+  HostRoutesIndex::const_iterator hostRoutes = m_hostRoutesIndex.find (dest);
+  if (hostRoutes != m_hostRoutesIndex.end ())
     {
-      NS_ASSERT ((*i)->IsHost ());
-      if ((*i)->GetDest () == dest)
+      for (std::vector<HostRoutesI>::const_iterator i = hostRoutes->second.begin (); 
+           i != hostRoutes->second.end (); 
+           i++) 
         {
+          Ipv4RoutingTableEntry *route = **i;
+          NS_ASSERT (route->IsHost () && route->GetDest () == dest);
           if (oif != 0)
             {
-              if (oif != m_ipv4->GetNetDevice ((*i)->GetInterface ()))
+              if (oif != m_ipv4->GetNetDevice (route->GetInterface ()))
                 {
                   NS_LOG_LOGIC ("Not on requested interface, skipping");
                   continue;
                 }
             }
-          allRoutes.push_back (*i);
-          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << *i); 
+          allRoutes.push_back (route);
+          NS_LOG_LOGIC (allRoutes.size () << "Found global host route" << route); 
         }
     }
   if (allRoutes.size () == 0) // if no host route is found
@@ -319,6 +343,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
           if (tmp  == index)
             {
               NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_hostRoutes.size ());
+              UnindexHostRoute (i);
               delete *i;
               m_hostRoutes.erase (i);
               NS_LOG_LOGIC ("Done removing host route " << index << "; host route remaining size = " << m_hostRoutes.size ());
@@ -380,6 +405,7 @@ Ipv4GlobalRouting::DoDispose (void)
     {
       delete (*i);
     }
+  m_hostRoutesIndex.clear ();
   for (NetworkRoutesI j = m_networkRoutes.begin (); 
        j != m_networkRoutes.end (); 
        j = m_networkRoutes.erase (j)) 
@@ -21,6 +21,8 @@
 #define IPV4_GLOBAL_ROUTING_H
 
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -245,6 +247,8 @@ private:
   typedef std::list<Ipv4RoutingTableEntry *>::const_iterator HostRoutesCI;
   /// iterator of container of Ipv4RoutingTableEntry (routes to hosts)
   typedef std::list<Ipv4RoutingTableEntry *>::iterator HostRoutesI;
+  /// routes to hosts indexed by destination, each in m_hostRoutes order
+  typedef std::unordered_map<Ipv4Address, std::vector<HostRoutesI>, Ipv4AddressHash> HostRoutesIndex;
 
   /// container of Ipv4RoutingTableEntry (routes to networks)
   typedef std::list<Ipv4RoutingTableEntry *> NetworkRoutes;
@@ -268,7 +272,14 @@ private:
    */
   Ptr<Ipv4Route> LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif = 0);
 
+  /**
+   * \brief Remove a route of m_hostRoutes from m_hostRoutesIndex.
+   * \param route the route
+   */
+  void UnindexHostRoute (HostRoutesI route);
+
   HostRoutes m_hostRoutes;             //!< Routes to hosts
+  HostRoutesIndex m_hostRoutesIndex;   //!< Routes to hosts, by destination
   NetworkRoutes m_networkRoutes;       //!< Routes to networks
   ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
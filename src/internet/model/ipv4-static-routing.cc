@@ -42,6 +42,17 @@ NS_LOG_COMPONENT_DEFINE ("Ipv4StaticRouting");
 
 NS_OBJECT_ENSURE_REGISTERED (Ipv4StaticRouting);
 
+/**
+ * \brief Build the prefix mask of a given length.
+ * \param prefixLength the prefix length, from 0 to 32
+ * \return the mask, in host byte order
+ */
+static inline uint32_t
+GetPrefixMask (uint16_t prefixLength)
+{
+  return prefixLength == 0 ? 0 : 0xffffffff << (32 - prefixLength);
+}
+
 TypeId
 Ipv4StaticRouting::GetTypeId (void)
 {
@@ -54,7 +65,8 @@ Ipv4StaticRouting::GetTypeId (void)
 }
 
 Ipv4StaticRouting::Ipv4StaticRouting () 
-  : m_ipv4 (0)
+  : m_nonPrefixRoutes (0),
+    m_ipv4 (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -77,6 +89,7 @@ Ipv4StaticRouting::AddNetworkRouteTo (Ipv4Address network,
     {
       Ipv4RoutingTableEntry *routePtr = new Ipv4RoutingTableEntry (route);
       m_networkRoutes.push_back (make_pair (routePtr, metric));
+      IndexNetworkRoute (--m_networkRoutes.end ());
     }
 }
 
@@ -96,6 +109,7 @@ Ipv4StaticRouting::AddNetworkRouteTo (Ipv4Address network,
       Ipv4RoutingTableEntry *routePtr = new Ipv4RoutingTableEntry (route);
 
       m_networkRoutes.push_back (make_pair (routePtr, metric));
+      IndexNetworkRoute (--m_networkRoutes.end ());
     }
 }
 
@@ -154,6 +168,7 @@ Ipv4StaticRouting::SetDefaultMulticastRoute (uint32_t outputInterface)
                                                         networkMask,
                                                         outputInterface);
   m_networkRoutes.push_back (make_pair (route,0));
+  IndexNetworkRoute (--m_networkRoutes.end ());
 }
 
 uint32_t 
@@ -229,9 +244,91 @@ Ipv4StaticRouting::RemoveMulticastRoute (uint32_t index)
     }
 }
 
+void
+Ipv4StaticRouting::IndexNetworkRoute (NetworkRoutesI route)
+{
+  Ipv4Mask mask = route->first->GetDestNetworkMask ();
+  uint16_t masklen = mask.GetPrefixLength ();
+  if (mask.Get () != GetPrefixMask (masklen))
+    {
+      NS_LOG_LOGIC ("Mask " << mask << " is not a prefix mask, the route is not indexed");
+      m_nonPrefixRoutes++;
+      return;
+    }
+  uint32_t prefix = route->first->GetDestNetwork ().Get () & mask.Get ();
+  m_prefixTables[masklen][prefix].push_back (route);
+}
+
+void
+Ipv4StaticRouting::UnindexNetworkRoute (NetworkRoutesI route)
+{
+  Ipv4Mask mask = route->first->GetDestNetworkMask ();
+  uint16_t masklen = mask.GetPrefixLength ();
+  if (mask.Get () != GetPrefixMask (masklen))
+    {
+      NS_ASSERT (m_nonPrefixRoutes > 0);
+      m_nonPrefixRoutes--;
+      return;
+    }
+  uint32_t prefix = route->first->GetDestNetwork ().Get () & mask.Get ();
+  PrefixTable::iterator it = m_prefixTables[masklen].find (prefix);
+  NS_ASSERT (it != m_prefixTables[masklen].end ());
+  PrefixRoutes &routes = it->second;
+  for (PrefixRoutes::iterator r = routes.begin (); r != routes.end (); r++)
+    {
+      if (*r == route)
+        {
+          routes.erase (r);
+          break;
+        }
+    }
+  if (routes.empty ())
+    {
+      m_prefixTables[masklen].erase (it);
+    }
+}
+
+Ipv4StaticRouting::PrefixRoutes *
+Ipv4StaticRouting::FindPrefixRoutes (const Ipv4RoutingTableEntry &route)
+{
+  Ipv4Mask mask = route.GetDestNetworkMask ();
+  uint16_t masklen = mask.GetPrefixLength ();
+  NS_ASSERT (mask.Get () == GetPrefixMask (masklen));
+  PrefixTable::iterator it = m_prefixTables[masklen].find (route.GetDestNetwork ().Get () & mask.Get ());
+  if (it == m_prefixTables[masklen].end ())
+    {
+      return 0;
+    }
+  return &it->second;
+}
+
 bool
 Ipv4StaticRouting::LookupRoute (const Ipv4RoutingTableEntry &route, uint32_t metric)
 {
+  Ipv4Mask mask = route.GetDestNetworkMask ();
+  if (mask.Get () == GetPrefixMask (mask.GetPrefixLength ()))
+    {
+      // routes with the same destination and mask share the prefix
+      PrefixRoutes *routes = FindPrefixRoutes (route);
+      if (routes == 0)
+        {
+          return false;
+        }
+      for (PrefixRoutes::const_iterator j = routes->begin (); j != routes->end (); j++)
+        {
+          Ipv4RoutingTableEntry* rtentry = (*j)->first;
+
+          if (rtentry->GetDest () == route.GetDest () &&
+              rtentry->GetGateway () == route.GetGateway () &&
+              rtentry->GetInterface () == route.GetInterface () &&
+              (*j)->second == metric)
+            {
+              return true;
+            }
+        }
+      return false;
+    }
+
   for (NetworkRoutesI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++)
     {
       Ipv4RoutingTableEntry* rtentry = j->first;
@@ -253,8 +350,6 @@ Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
 {
   NS_LOG_FUNCTION (this << dest << " " << oif);
   Ptr<Ipv4Route> rtentry = 0;
-  uint16_t longest_mask = 0;
-  uint32_t shortest_metric = 0xffffffff;
   /* when sending on local multicast, there have to be interface specified */
   if (dest.IsLocalMulticast ())
     {
@@ -268,7 +363,86 @@ Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
       return rtentry;
     }
 
+  Ipv4RoutingTableEntry* route = m_nonPrefixRoutes == 0 ? LookupPrefixIndex (dest, oif) : LookupScan (dest, oif);
+  if (route != 0)
+    {
+      uint32_t interfaceIdx = route->GetInterface ();
+      rtentry = Create<Ipv4Route> ();
+      rtentry->SetDestination (route->GetDest ());
+      rtentry->SetSource (m_ipv4->SourceAddressSelection (interfaceIdx, route->GetDest ()));
+      rtentry->SetGateway (route->GetGateway ());
+      rtentry->SetOutputDevice (m_ipv4->GetNetDevice (interfaceIdx));
+      NS_LOG_LOGIC ("Matching route via " << rtentry->GetGateway () << " at the end");
+    }
+  else
+    {
+      NS_LOG_LOGIC ("No matching route to " << dest << " found");
+    }
+  return rtentry;
+}
+
+Ipv4RoutingTableEntry *
+Ipv4StaticRouting::LookupPrefixIndex (Ipv4Address dest, Ptr<NetDevice> oif)
+{
+  NS_LOG_FUNCTION (this << dest << " " << oif);
+  // Visit the prefix lengths from the longest one: the first length with
+  // a usable route wins, and among its routes the selection is the one of
+  // the forwarding table scan (lowest metric, last one on ties, first
+  // host route).
+  for (int masklen = 32; masklen >= 0; masklen--)
+    {
+      const PrefixTable &table = m_prefixTables[masklen];
+      if (table.empty ())
+        {
+          continue;
+        }
+      PrefixTable::const_iterator it = table.find (dest.Get () & GetPrefixMask (masklen));
+      if (it == table.end ())
+        {
+          continue;
+        }
+      Ipv4RoutingTableEntry *route = 0;
+      uint32_t shortest_metric = 0xffffffff;
+      for (PrefixRoutes::const_iterator i = it->second.begin (); i != it->second.end (); i++)
+        {
+          Ipv4RoutingTableEntry *j = (*i)->first;
+          uint32_t metric = (*i)->second;
+          NS_LOG_LOGIC ("Found network route " << j << ", mask length " << masklen << ", metric " << metric);
+          if (oif != 0)
+            {
+              if (oif != m_ipv4->GetNetDevice (j->GetInterface ()))
+                {
+                  NS_LOG_LOGIC ("Not on requested interface, skipping");
+                  continue;
+                }
+            }
+          if (metric > shortest_metric)
+            {
+              NS_LOG_LOGIC ("Equal mask length, but previous metric shorter, skipping");
+              continue;
+            }
+          shortest_metric = metric;
+          route = j;
+          if (masklen == 32)
+            {
+              break;
+            }
+        }
+      if (route != 0)
+        {
+          return route;
+        }
+    }
+  return 0;
+}
 
+Ipv4RoutingTableEntry *
+Ipv4StaticRouting::LookupScan (Ipv4Address dest, Ptr<NetDevice> oif)
+{
+  NS_LOG_FUNCTION (this << dest << " " << oif);
+  Ipv4RoutingTableEntry *route = 0;
+  uint16_t longest_mask = 0;
+  uint32_t shortest_metric = 0xffffffff;
   for (NetworkRoutesI i = m_networkRoutes.begin (); 
        i != m_networkRoutes.end (); 
        i++) 
@@ -306,28 +480,14 @@ Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
               continue;
             }
           shortest_metric = metric;
-          Ipv4RoutingTableEntry* route = (j);
-          uint32_t interfaceIdx = route->GetInterface ();
-          rtentry = Create<Ipv4Route> ();
-          rtentry->SetDestination (route->GetDest ());
-          rtentry->SetSource (m_ipv4->SourceAddressSelection (interfaceIdx, route->GetDest ()));
-          rtentry->SetGateway (route->GetGateway ());
-          rtentry->SetOutputDevice (m_ipv4->GetNetDevice (interfaceIdx));
+          route = j;
           if (masklen == 32)
             {
               break;
             }
         }
     }
-  if (rtentry != 0)
-    {
-      NS_LOG_LOGIC ("Matching route via " << rtentry->GetGateway () << " at the end");
-    }
-  else
-    {
-      NS_LOG_LOGIC ("No matching route to " << dest << " found");
-    }
-  return rtentry;
+  return route;
 }
 
 Ptr<Ipv4MulticastRoute>
@@ -476,6 +636,7 @@ Ipv4StaticRouting::RemoveRoute (uint32_t index)
     {
       if (tmp == index)
         {
+          UnindexNetworkRoute (j);
           delete j->first;
           m_networkRoutes.erase (j);
           return;
@@ -604,6 +765,11 @@ Ipv4StaticRouting::DoDispose (void)
     {
       delete (j->first);
     }
+  for (uint16_t masklen = 0; masklen <= 32; masklen++)
+    {
+      m_prefixTables[masklen].clear ();
+    }
+  m_nonPrefixRoutes = 0;
   for (MulticastRoutesI i = m_multicastRoutes.begin (); 
        i != m_multicastRoutes.end (); 
        i = m_multicastRoutes.erase (i)) 
@@ -642,6 +808,7 @@ Ipv4StaticRouting::NotifyInterfaceDown (uint32_t i)
     {
       if (it->first->GetInterface () == i)
         {
+          UnindexNetworkRoute (it);
           delete it->first;
           it = m_networkRoutes.erase (it);
         }
@@ -689,6 +856,7 @@ Ipv4StaticRouting::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress
           && it->first->GetDestNetwork () == networkAddress
           && it->first->GetDestNetworkMask () == networkMask)
         {
+          UnindexNetworkRoute (it);
           delete it->first;
           it = m_networkRoutes.erase (it);
         }
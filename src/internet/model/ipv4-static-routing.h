@@ -23,7 +23,9 @@
 #define IPV4_STATIC_ROUTING_H
 
 #include <list>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -376,6 +378,51 @@ private:
   /// Iterator for container for the multicast routes
   typedef std::list<Ipv4MulticastRoutingTableEntry *>::iterator MulticastRoutesI;
 
+  /// Network routes towards the same destination prefix, in forwarding table order
+  typedef std::vector<NetworkRoutesI> PrefixRoutes;
+
+  /// Network routes with the same prefix length, indexed by destination prefix
+  typedef std::unordered_map<uint32_t, PrefixRoutes> PrefixTable;
+
+  /**
+   * \brief Add a route of m_networkRoutes to the prefix index.
+   * \param route the route, which must be the last one of its prefix
+   */
+  void IndexNetworkRoute (NetworkRoutesI route);
+
+  /**
+   * \brief Remove a route of m_networkRoutes from the prefix index.
+   * \param route the route
+   */
+  void UnindexNetworkRoute (NetworkRoutesI route);
+
+  /**
+   * \brief Find the routes indexed under the prefix of a route entry.
+   * \param route the route entry
+   * \return the routes with the same destination prefix, or 0 if none
+   */
+  PrefixRoutes *FindPrefixRoutes (const Ipv4RoutingTableEntry &route);
+
+  /**
+   * \brief Longest prefix match through the prefix index.
+   * \param dest destination address
+   * \param oif output interface if any (put 0 otherwise)
+   * \return the selected network route, or 0 if no route matches
+   */
+  Ipv4RoutingTableEntry *LookupPrefixIndex (Ipv4Address dest, Ptr<NetDevice> oif);
+
+  /**
+   * \brief Longest prefix match through a scan of the whole forwarding table.
+   *
+   * Used when some route has a mask that is not a prefix mask, as such
+   * routes can not be indexed.
+   *
+   * \param dest destination address
+   * \param oif output interface if any (put 0 otherwise)
+   * \return the selected network route, or 0 if no route matches
+   */
+  Ipv4RoutingTableEntry *LookupScan (Ipv4Address dest, Ptr<NetDevice> oif);
+
   /**
    * \brief Checks if a route is already present in the forwarding table.
    * \param route route
@@ -407,6 +454,20 @@ private:
    */
   NetworkRoutes m_networkRoutes;
 
+  /**
+   * \brief the network routes indexed by prefix length (0 to 32) and
+   * destination prefix.
+   *
+   * The routes of each prefix keep the order of m_networkRoutes, so the
+   * metric tie-breaking of the forwarding table scan is preserved.
+   */
+  PrefixTable m_prefixTables[33];
+
+  /**
+   * \brief number of network routes whose mask is not a prefix mask.
+   */
+  uint32_t m_nonPrefixRoutes;
+
   /**
    * \brief the forwarding table for multicast.
    */
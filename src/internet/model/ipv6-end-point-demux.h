@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 #include <list>
+#include <unordered_map>
 #include "ns3/ipv6-address.h"
 #include "ipv6-interface.h"
 
@@ -178,6 +179,78 @@ private:
    * \brief A list of IPv6 end points.
    */
   EndPoints m_endPoints;
+
+  /**
+   * \brief Four-tuple (local address/port, peer address/port) of a fully
+   * specified endpoint.
+   */
+  struct ConnectedKey
+  {
+    Ipv6Address localAddress; //!< local address
+    Ipv6Address peerAddress;  //!< peer address
+    uint16_t localPort;         //!< local port
+    uint16_t peerPort;          //!< peer port
+
+    /**
+     * \brief Equality operator.
+     * \param other the key to compare with
+     * \return true if the two keys are equal
+     */
+    bool operator== (const ConnectedKey &other) const
+    {
+      return localPort == other.localPort && peerPort == other.peerPort
+             && localAddress == other.localAddress && peerAddress == other.peerAddress;
+    }
+  };
+
+  /**
+   * \brief Hash function for ConnectedKey.
+   */
+  struct ConnectedKeyHash
+  {
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    size_t operator() (const ConnectedKey &key) const
+    {
+      Ipv6AddressHash addressHash;
+      size_t h = addressHash (key.localAddress);
+      h = h * 31 + addressHash (key.peerAddress);
+      return h * 31 + ((static_cast<size_t> (key.localPort) << 16) | key.peerPort);
+    }
+  };
+
+  /**
+   * \brief Container of the endpoints indexed by their exact four-tuple.
+   */
+  typedef std::unordered_map<ConnectedKey, Ipv6EndPoint *, ConnectedKeyHash> ConnectedEndPoints;
+
+  /**
+   * \brief Look for a cached exact (four-tuple) match.
+   *
+   * The entry is checked against the current state of the endpoint, as
+   * sockets can change the addresses of an endpoint after it has been
+   * allocated; stale entries are dropped.
+   *
+   * \param key the four-tuple of the incoming packet
+   * \param incomingInterface the incoming interface
+   * \return the matching endpoint, or 0 if the full lookup must be done
+   */
+  Ipv6EndPoint *LookupConnected (const ConnectedKey &key, Ptr<Ipv6Interface> incomingInterface);
+
+  /**
+   * \brief Exact matches found by Lookup, so that packets of established
+   * connections do not require a scan of the whole endpoint list.
+   *
+   * Only endpoints that were the single case-4 (all four fields) match,
+   * and the only endpoint with their four-tuple, are stored here: another
+   * endpoint with the same four-tuple (bound to another device, or not
+   * receiving) could be chosen by the scan for a packet on another
+   * device.  Wildcard (listening) endpoints are always resolved by the
+   * ranked scan of m_endPoints.
+   */
+  ConnectedEndPoints m_connected;
 };
 
 } /* namespace ns3 */
@@ -0,0 +1,168 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+/**
+ * This is the test code for the cache of connected endpoints of
+ * ipv4-end-point-demux.cc
+ */
+
+#include "ns3/test.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-end-point-demux.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 endpoint demultiplexer connected endpoint cache test.
+ *
+ * The cache must always give the answer of the full lookup.
+ */
+class Ipv4EndPointDemuxTestCase : public TestCase
+{
+public:
+  Ipv4EndPointDemuxTestCase ();
+  virtual ~Ipv4EndPointDemuxTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Look up the test four-tuple.
+   * \param peerPort the peer port
+   * \param incomingInterface the incoming interface
+   * \return the endpoint found, 0 if none
+   */
+  Ipv4EndPoint *Lookup (uint16_t peerPort, Ptr<Ipv4Interface> incomingInterface);
+
+  /**
+   * \brief Get the cached endpoint of the test four-tuple.
+   * \return the endpoint cached, 0 if none
+   */
+  Ipv4EndPoint *GetCached (void);
+
+  Ipv4EndPointDemux m_demux;  //!< The demultiplexer
+  Ipv4Address m_local;        //!< The local address
+  Ipv4Address m_peer;         //!< The peer address
+};
+
+Ipv4EndPointDemuxTestCase::Ipv4EndPointDemuxTestCase ()
+  : TestCase ("Verify the connected endpoint cache of the IPv4 demultiplexer"),
+    m_local ("10.1.1.1"),
+    m_peer ("10.1.1.2")
+{
+}
+
+Ipv4EndPointDemuxTestCase::~Ipv4EndPointDemuxTestCase ()
+{
+}
+
+Ipv4EndPoint *
+Ipv4EndPointDemuxTestCase::Lookup (uint16_t peerPort, Ptr<Ipv4Interface> incomingInterface)
+{
+  Ipv4EndPointDemux::EndPoints endPoints = m_demux.Lookup (m_local, 80, m_peer, peerPort, incomingInterface);
+  NS_ASSERT (endPoints.size () <= 1);
+  return endPoints.empty () ? 0 : endPoints.front ();
+}
+
+Ipv4EndPoint *
+Ipv4EndPointDemuxTestCase::GetCached (void)
+{
+  Ipv4EndPointDemux::ConnectedKey key = {m_local, m_peer, 80, 1234};
+  Ipv4EndPointDemux::ConnectedEndPoints::iterator it = m_demux.m_connected.find (key);
+  return it == m_demux.m_connected.end () ? 0 : it->second;
+}
+
+void
+Ipv4EndPointDemuxTestCase::DoRun (void)
+{
+  Ptr<SimpleNetDevice> deviceA = CreateObject<SimpleNetDevice> ();
+  Ptr<Ipv4Interface> interfaceA = CreateObject<Ipv4Interface> ();
+  interfaceA->SetDevice (deviceA);
+  Ptr<SimpleNetDevice> deviceB = CreateObject<SimpleNetDevice> ();
+  Ptr<Ipv4Interface> interfaceB = CreateObject<Ipv4Interface> ();
+  interfaceB->SetDevice (deviceB);
+
+  // Cache hit
+  Ipv4EndPoint *x = m_demux.Allocate (0, m_local, 80, m_peer, 1234);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Connected endpoint not found");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), x, "Connected endpoint not cached");
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Cached endpoint not found");
+
+  // Stale entries once the endpoint addresses change
+  x->SetPeer (m_peer, 1235);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), 0, "Endpoint found under its old peer port");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), 0, "Stale entry not dropped");
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1235, interfaceA), x, "Endpoint not found under its new peer port");
+  x->SetPeer (m_peer, 1234);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Endpoint not found after restoring its peer port");
+  x->SetLocalAddress (Ipv4Address ("10.1.1.3"));
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), 0, "Endpoint found under its old local address");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), 0, "Stale entry not dropped");
+  x->SetLocalAddress (m_local);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Endpoint not found after restoring its local address");
+
+  // Endpoints not receiving are left to the full lookup
+  x->SetRxEnabled (false);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), 0, "Endpoint found while it cannot receive");
+  x->SetRxEnabled (true);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Endpoint not found once it can receive again");
+
+  // Endpoints bound to another device are left to the full lookup
+  x->BindToNetDevice (deviceA);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceB), 0, "Endpoint found on another device than its own");
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Endpoint not found on its own device");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), x, "Bound endpoint not cached");
+
+  // A tuple shared by two endpoints is never cached: y must not be
+  // returned for the packets of device A, where the full lookup finds x too
+  Ipv4EndPoint *y = m_demux.Allocate (0, m_local, 80, m_peer, 1234);
+  NS_TEST_ASSERT_MSG_NE (y, 0, "Unbound endpoint with the tuple of a bound one not allocated");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), 0, "Entry of a shared tuple not dropped by Allocate");
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceB), y, "Unbound endpoint not found on device B");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), 0, "Shared tuple cached");
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceB), y, "Unbound endpoint not found again on device B");
+
+  // DeAllocate removes the entry
+  m_demux.DeAllocate (y);
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), x, "Endpoint not found once the tuple is unique again");
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), x, "Unique tuple not cached");
+  m_demux.DeAllocate (x);
+  NS_TEST_ASSERT_MSG_EQ (GetCached (), 0, "Entry of a deallocated endpoint not removed");
+  NS_TEST_ASSERT_MSG_EQ (Lookup (1234, interfaceA), 0, "Deallocated endpoint found");
+}
+
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 endpoint demultiplexer TestSuite
+ */
+class Ipv4EndPointDemuxTestSuite : public TestSuite
+{
+public:
+  Ipv4EndPointDemuxTestSuite () :
+    TestSuite ("ipv4-end-point-demux", UNIT)
+  {
+    AddTestCase (new Ipv4EndPointDemuxTestCase (), TestCase::QUICK);
+  }
+};
+
+static Ipv4EndPointDemuxTestSuite g_ipv4EndPointDemuxTestSuite; //!< Static variable for test initialization
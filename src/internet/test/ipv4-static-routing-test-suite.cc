@@ -22,6 +22,7 @@
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
 #include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-route.h"
 #include "ns3/node.h"
 #include "ns3/node-container.h"
 #include "ns3/packet.h"
@@ -201,6 +202,88 @@ Ipv4StaticRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 StaticRouting longest prefix match Test
+ *
+ * Checks the route selection (longest prefix, then lowest metric, with
+ * the last route winning metric ties and the first host route winning)
+ * as routes are added and removed.
+ */
+class Ipv4StaticRoutingLongestPrefixTestCase : public TestCase
+{
+public:
+  Ipv4StaticRoutingLongestPrefixTestCase ();
+
+private:
+  /**
+   * \brief Checks the gateway selected for a destination.
+   * \param routing The static routing.
+   * \param dest The destination address.
+   * \param gateway The expected gateway.
+   */
+  void CheckGateway (Ptr<Ipv4StaticRouting> routing, std::string dest, std::string gateway);
+
+  virtual void DoRun (void);
+};
+
+Ipv4StaticRoutingLongestPrefixTestCase::Ipv4StaticRoutingLongestPrefixTestCase ()
+  : TestCase ("Longest prefix match of static routes")
+{
+}
+
+void
+Ipv4StaticRoutingLongestPrefixTestCase::CheckGateway (Ptr<Ipv4StaticRouting> routing, std::string dest, std::string gateway)
+{
+  Ipv4Header header;
+  header.SetDestination (Ipv4Address (dest.c_str ()));
+  Socket::SocketErrno err;
+  Ptr<Ipv4Route> route = routing->RouteOutput (0, header, 0, err);
+  NS_TEST_ASSERT_MSG_NE (route, 0, "No route to " << dest);
+  NS_TEST_EXPECT_MSG_EQ (route->GetGateway (), Ipv4Address (gateway.c_str ()), "Wrong route to " << dest);
+}
+
+void
+Ipv4StaticRoutingLongestPrefixTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+
+  // all the routes use the loopback interface, only the gateways differ
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  Ptr<Ipv4StaticRouting> routing = ipv4RoutingHelper.GetStaticRouting (node->GetObject<Ipv4> ());
+  routing->SetDefaultRoute (Ipv4Address ("127.0.0.10"), 0);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.0.0.0"), Ipv4Mask ("255.0.0.0"), Ipv4Address ("127.0.0.11"), 0, 5);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.1.0.0"), Ipv4Mask ("255.255.0.0"), Ipv4Address ("127.0.0.12"), 0, 3);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.1.0.0"), Ipv4Mask ("255.255.0.0"), Ipv4Address ("127.0.0.13"), 0, 3);
+  routing->AddNetworkRouteTo (Ipv4Address ("10.1.0.0"), Ipv4Mask ("255.255.0.0"), Ipv4Address ("127.0.0.14"), 0, 7);
+  uint32_t firstHostRoute = routing->GetNRoutes ();
+  routing->AddHostRouteTo (Ipv4Address ("10.1.2.3"), Ipv4Address ("127.0.0.15"), 0, 9);
+  routing->AddHostRouteTo (Ipv4Address ("10.1.2.3"), Ipv4Address ("127.0.0.16"), 0, 1);
+
+  CheckGateway (routing, "10.1.2.3", "127.0.0.15");
+  CheckGateway (routing, "10.1.9.9", "127.0.0.13");
+  CheckGateway (routing, "10.5.9.1", "127.0.0.11");
+  CheckGateway (routing, "11.0.0.1", "127.0.0.10");
+
+  routing->RemoveRoute (firstHostRoute);
+  CheckGateway (routing, "10.1.2.3", "127.0.0.16");
+  routing->RemoveRoute (firstHostRoute);
+  CheckGateway (routing, "10.1.2.3", "127.0.0.13");
+
+  // a mask that is not a prefix mask
+  routing->AddNetworkRouteTo (Ipv4Address ("10.0.9.0"), Ipv4Mask ("255.0.255.0"), Ipv4Address ("127.0.0.17"), 0, 0);
+  CheckGateway (routing, "10.5.9.1", "127.0.0.17");
+  CheckGateway (routing, "10.1.8.9", "127.0.0.13");
+  routing->RemoveRoute (routing->GetNRoutes () - 1);
+  CheckGateway (routing, "10.5.9.1", "127.0.0.11");
+
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -217,6 +300,7 @@ Ipv4StaticRoutingTestSuite::Ipv4StaticRoutingTestSuite ()
   : TestSuite ("ipv4-static-routing", UNIT)
 {
   AddTestCase (new Ipv4StaticRoutingSlash32TestCase, TestCase::QUICK);
+  AddTestCase (new Ipv4StaticRoutingLongestPrefixTestCase, TestCase::QUICK);
 }
 
 static Ipv4StaticRoutingTestSuite ipv4StaticRoutingTestSuite; //!< Static variable for test initialization
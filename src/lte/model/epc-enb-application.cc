@@ -193,7 +193,7 @@ void
 EpcEnbApplication::DoUeContextRelease (uint16_t rnti)
 {
   NS_LOG_FUNCTION (this << rnti);
-  std::map<uint16_t, std::map<uint8_t, uint32_t> >::iterator rntiIt = m_rbidTeidMap.find (rnti);
+  std::unordered_map<uint16_t, std::map<uint8_t, uint32_t> >::iterator rntiIt = m_rbidTeidMap.find (rnti);
   if (rntiIt != m_rbidTeidMap.end ())
     {
       for (std::map<uint8_t, uint32_t>::iterator bidIt = rntiIt->second.begin ();
@@ -277,7 +277,7 @@ EpcEnbApplication::RecvFromLteSocket (Ptr<Socket> socket)
   uint16_t rnti = tag.GetRnti ();
   uint8_t bid = tag.GetBid ();
   NS_LOG_LOGIC ("received packet with RNTI=" << (uint32_t) rnti << ", BID=" << (uint32_t)  bid);
-  std::map<uint16_t, std::map<uint8_t, uint32_t> >::iterator rntiIt = m_rbidTeidMap.find (rnti);
+  std::unordered_map<uint16_t, std::map<uint8_t, uint32_t> >::iterator rntiIt = m_rbidTeidMap.find (rnti);
   if (rntiIt == m_rbidTeidMap.end ())
     {
       NS_LOG_WARN ("UE context not found, discarding packet when receiving from lteSocket");
@@ -307,7 +307,7 @@ EpcEnbApplication::RecvFromS1uSocket (Ptr<Socket> socket)
   //SocketAddressTag tag;
   //packet->RemovePacketTag (tag);
 
-  std::map<uint32_t, EpsFlowId_t>::iterator it = m_teidRbidMap.find (teid);
+  std::unordered_map<uint32_t, EpsFlowId_t>::iterator it = m_teidRbidMap.find (teid);
   if (it != m_teidRbidMap.end ())
     {
       m_rxS1uSocketPktTrace (packet->Copy ());
@@ -38,6 +38,7 @@
 #include <ns3/eps-bearer.h>
 #include <ns3/epc-enb-s1-sap.h>
 #include <ns3/epc-s1ap-sap.h>
+#include <unordered_map>
 #include <map>
 
 namespace ns3 {
@@ -229,13 +230,13 @@ private:
    * map of maps telling for each RNTI and BID the corresponding  S1-U TEID
    *
    */
-  std::map<uint16_t, std::map<uint8_t, uint32_t> > m_rbidTeidMap;
+  std::unordered_map<uint16_t, std::map<uint8_t, uint32_t> > m_rbidTeidMap;
 
   /**
    * map telling for each S1-U TEID the corresponding RNTI,BID
    *
    */
-  std::map<uint32_t, EpsFlowId_t> m_teidRbidMap;
+  std::unordered_map<uint32_t, EpsFlowId_t> m_teidRbidMap;
 
   /**
    * UDP port to be used for GTP
@@ -168,17 +168,16 @@ EpcSgwPgwApplication::RecvFromTunDevice (Ptr<Packet> packet, const Address& sour
 {
   NS_LOG_FUNCTION (this << source << dest << protocolNumber << packet << packet->GetSize ());
   m_rxTunPktTrace (packet->Copy ());
-  Ptr<Packet> pCopy = packet->Copy ();
 
   // get IP address of UE
   if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
     {
       Ipv4Header ipv4Header;
-      pCopy->RemoveHeader (ipv4Header);
+      packet->PeekHeader (ipv4Header);
       Ipv4Address ueAddr =  ipv4Header.GetDestination ();
       NS_LOG_LOGIC ("packet addressed to UE " << ueAddr);
       // find corresponding UeInfo address
-      std::map<Ipv4Address, Ptr<UeInfo> >::iterator it = m_ueInfoByAddrMap.find (ueAddr);
+      std::unordered_map<Ipv4Address, Ptr<UeInfo>, Ipv4AddressHash>::iterator it = m_ueInfoByAddrMap.find (ueAddr);
       if (it == m_ueInfoByAddrMap.end ())
         {
           NS_LOG_WARN ("unknown UE address " << ueAddr);
@@ -200,11 +199,11 @@ EpcSgwPgwApplication::RecvFromTunDevice (Ptr<Packet> packet, const Address& sour
     else if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
       {
         Ipv6Header ipv6Header;
-        pCopy->RemoveHeader (ipv6Header);
+        packet->PeekHeader (ipv6Header);
         Ipv6Address ueAddr =  ipv6Header.GetDestinationAddress ();
         NS_LOG_LOGIC ("packet addressed to UE " << ueAddr);
         // find corresponding UeInfo address
-        std::map<Ipv6Address, Ptr<UeInfo> >::iterator it = m_ueInfoByAddrMap6.find (ueAddr);
+        std::unordered_map<Ipv6Address, Ptr<UeInfo>, Ipv6AddressHash>::iterator it = m_ueInfoByAddrMap6.find (ueAddr);
         if (it == m_ueInfoByAddrMap6.end ())
           {
             NS_LOG_WARN ("unknown UE address " << ueAddr);
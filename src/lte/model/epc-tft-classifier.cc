@@ -29,8 +29,6 @@
 #include "ns3/packet.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv6-header.h"
-#include "ns3/udp-header.h"
-#include "ns3/tcp-header.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/udp-l4-protocol.h"
@@ -42,6 +40,8 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EpcTftClassifier");
 
+const uint32_t EpcTftClassifier::MAX_CACHED_FLOWS = 4096;
+
 EpcTftClassifier::EpcTftClassifier ()
 {
   NS_LOG_FUNCTION (this);
@@ -52,6 +52,7 @@ EpcTftClassifier::Add (Ptr<EpcTft> tft, uint32_t id)
 {
   NS_LOG_FUNCTION (this << tft << id);
   m_tftMap[id] = tft;
+  m_flowCache.clear ();
 
   // simple sanity check: there shouldn't be more than 16 bearers (hence TFTs) per UE
   NS_ASSERT (m_tftMap.size () <= 16);
@@ -62,6 +63,32 @@ EpcTftClassifier::Delete (uint32_t id)
 {
   NS_LOG_FUNCTION (this << id);
   m_tftMap.erase (id);
+  m_flowCache.clear ();
+}
+
+/**
+ * Read the source and destination ports at the start of a UDP or TCP header
+ * without removing the headers from the packet
+ *
+ * \param p the IP packet
+ * \param l4Offset the size of the IP header
+ * \param sourcePort the source port
+ * \param destinationPort the destination port
+ * \return true if the packet is long enough to hold the ports
+ */
+static bool
+PeekPorts (Ptr<const Packet> p, uint32_t l4Offset, uint16_t &sourcePort, uint16_t &destinationPort)
+{
+  // the largest IP header is the IPv4 one with options (60 bytes)
+  uint8_t buffer[64];
+  NS_ASSERT (l4Offset + 4 <= sizeof (buffer));
+  if (p->CopyData (buffer, l4Offset + 4) < l4Offset + 4)
+    {
+      return false;
+    }
+  sourcePort = (buffer[l4Offset] << 8) | buffer[l4Offset + 1];
+  destinationPort = (buffer[l4Offset + 2] << 8) | buffer[l4Offset + 3];
+  return true;
 }
 
 uint32_t
@@ -69,8 +96,6 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
 {
   NS_LOG_FUNCTION (this << p << p->GetSize () << direction);
 
-  Ptr<Packet> pCopy = p->Copy ();
-
   Ipv4Address localAddressIpv4;
   Ipv4Address remoteAddressIpv4;
 
@@ -83,10 +108,15 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
   uint16_t localPort = 0;
   uint16_t remotePort = 0;
 
+  // the headers are only peeked, the ports are read directly from
+  // the bytes following the IP header
+  uint16_t sourcePort = 0;
+  uint16_t destinationPort = 0;
+
   if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
     {
       Ipv4Header ipv4Header;
-      pCopy->RemoveHeader (ipv4Header);
+      p->PeekHeader (ipv4Header);
 
       if (direction ==  EpcTft::UPLINK)
         {
@@ -117,19 +147,19 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
       // i.e. it is the first one but it is not the last one
       if (fragmentOffset == 0)
         {
-          if (protocol == UdpL4Protocol::PROT_NUMBER && payloadSize >= 8)
+          if ((protocol == UdpL4Protocol::PROT_NUMBER && payloadSize >= 8)
+              || (protocol == TcpL4Protocol::PROT_NUMBER && payloadSize >= 20))
             {
-              UdpHeader udpHeader;
-              pCopy->RemoveHeader (udpHeader);
+              PeekPorts (p, ipv4Header.GetSerializedSize (), sourcePort, destinationPort);
               if (direction ==  EpcTft::UPLINK)
                 {
-                  localPort = udpHeader.GetSourcePort ();
-                  remotePort = udpHeader.GetDestinationPort ();
+                  localPort = sourcePort;
+                  remotePort = destinationPort;
                 }
               else
                 {
-                  remotePort = udpHeader.GetSourcePort ();
-                  localPort = udpHeader.GetDestinationPort ();
+                  remotePort = sourcePort;
+                  localPort = destinationPort;
                 }
               if (!isLastFragment)
                 {
@@ -142,32 +172,6 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
                   m_classifiedIpv4Fragments[fragmentKey] = std::make_pair (localPort, remotePort);
                 }
             }
-          else if (protocol == TcpL4Protocol::PROT_NUMBER && payloadSize >= 20)
-            {
-              TcpHeader tcpHeader;
-              pCopy->RemoveHeader (tcpHeader);
-              if (direction ==  EpcTft::UPLINK)
-                {
-                  localPort = tcpHeader.GetSourcePort ();
-                  remotePort = tcpHeader.GetDestinationPort ();
-                }
-              else
-                {
-                  remotePort = tcpHeader.GetSourcePort ();
-                  localPort = tcpHeader.GetDestinationPort ();
-                }
-
-              if (!isLastFragment)
-                {
-                  std::tuple<uint32_t, uint32_t, uint8_t, uint16_t> fragmentKey =
-                      std::make_tuple (ipv4Header.GetSource ().Get (),
-                                       ipv4Header.GetDestination ().Get (),
-                                       protocol,
-                                       ipv4Header.GetIdentification ());
-
-                  m_classifiedIpv4Fragments[fragmentKey] = std::make_pair (localPort, remotePort);
-                }
-            }
 
           // else
           //   First fragment but not enough data for port info or not UDP/TCP protocol.
@@ -202,7 +206,7 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
   else if (protocolNumber == Ipv6L3Protocol::PROT_NUMBER)
     {
       Ipv6Header ipv6Header;
-      pCopy->RemoveHeader (ipv6Header);
+      p->PeekHeader (ipv6Header);
 
       if (direction ==  EpcTft::UPLINK)
         {
@@ -220,35 +224,18 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
       protocol = ipv6Header.GetNextHeader ();
       tos = ipv6Header.GetTrafficClass ();
 
-      if (protocol == UdpL4Protocol::PROT_NUMBER)
+      if (protocol == UdpL4Protocol::PROT_NUMBER || protocol == TcpL4Protocol::PROT_NUMBER)
         {
-          UdpHeader udpHeader;
-          pCopy->RemoveHeader (udpHeader);
-
+          PeekPorts (p, ipv6Header.GetSerializedSize (), sourcePort, destinationPort);
           if (direction ==  EpcTft::UPLINK)
             {
-              localPort = udpHeader.GetSourcePort ();
-              remotePort = udpHeader.GetDestinationPort ();
+              localPort = sourcePort;
+              remotePort = destinationPort;
             }
           else
             {
-              remotePort = udpHeader.GetSourcePort ();
-              localPort = udpHeader.GetDestinationPort ();
-            }
-        }
-      else if (protocol == TcpL4Protocol::PROT_NUMBER)
-        {
-          TcpHeader tcpHeader;
-          pCopy->RemoveHeader (tcpHeader);
-          if (direction ==  EpcTft::UPLINK)
-            {
-              localPort = tcpHeader.GetSourcePort ();
-              remotePort = tcpHeader.GetDestinationPort ();
-            }
-          else
-            {
-              remotePort = tcpHeader.GetSourcePort ();
-              localPort = tcpHeader.GetDestinationPort ();
+              remotePort = sourcePort;
+              localPort = destinationPort;
             }
         }
     }
@@ -257,7 +244,32 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
       NS_ABORT_MSG ("EpcTftClassifier::Classify - Unknown IP type...");
     }
 
+  // the TFTs only look at the fields of the key, so packets of an already
+  // classified flow get the same result
+  FlowKey key;
+  key.protocolNumber = protocolNumber;
+  key.direction = direction;
+  key.tos = tos;
+  key.remotePort = remotePort;
+  key.localPort = localPort;
+  if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
+    {
+      key.remoteAddress = Ipv6Address::MakeIpv4MappedAddress (remoteAddressIpv4);
+      key.localAddress = Ipv6Address::MakeIpv4MappedAddress (localAddressIpv4);
+    }
+  else
+    {
+      key.remoteAddress = remoteAddressIpv6;
+      key.localAddress = localAddressIpv6;
+    }
+  FlowCache::const_iterator cached = m_flowCache.find (key);
+  if (cached != m_flowCache.end ())
+    {
+      NS_LOG_LOGIC ("flow already classified with TFT ID = " << cached->second);
+      return cached->second;
+    }
 
+  uint32_t id = 0;  // no match
   if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
     {
       NS_LOG_INFO ("Classifying packet:"
@@ -281,7 +293,8 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
           if (tft->Matches (direction, remoteAddressIpv4, localAddressIpv4, remotePort, localPort, tos))
             {
               NS_LOG_LOGIC ("matches with TFT ID = " << it->first);
-              return it->first; // the id of the matching TFT
+              id = it->first; // the id of the matching TFT
+              break;
             }
         }
     }
@@ -308,12 +321,23 @@ EpcTftClassifier::Classify (Ptr<Packet> p, EpcTft::Direction direction, uint16_t
           if (tft->Matches (direction, remoteAddressIpv6, localAddressIpv6, remotePort, localPort, tos))
             {
               NS_LOG_LOGIC ("matches with TFT ID = " << it->first);
-              return it->first; // the id of the matching TFT
+              id = it->first; // the id of the matching TFT
+              break;
             }
         }
     }
-  NS_LOG_LOGIC ("no match");
-  return 0;  // no match
+  if (id == 0)
+    {
+      NS_LOG_LOGIC ("no match");
+    }
+
+  if (m_flowCache.size () >= MAX_CACHED_FLOWS)
+    {
+      // keep the memory bounded when the flows come and go
+      m_flowCache.clear ();
+    }
+  m_flowCache[key] = id;
+  return id;
 }
 
 
@@ -27,7 +27,10 @@
 #include "ns3/simple-ref-count.h"
 #include "ns3/epc-tft.h"
 
+#include "ns3/ipv6-address.h"
+
 #include <map>
+#include <unordered_map>
 
 
 namespace ns3 {
@@ -50,6 +53,12 @@ class Packet;
  *
  * When we cannot cache the port info, the TFT of the default bearer is used. This may happen
  * if there is reordering or losses of IP packets.
+ *
+ * The result of the classification of each flow (addresses, ports and
+ * type of service) is cached, so that only the first packets of a flow
+ * are matched against the TFTs. The cache is flushed when a TFT is added
+ * or deleted; the packet filters of a TFT must not be changed after it
+ * has been added to the classifier.
  */
 class EpcTftClassifier : public SimpleRefCount<EpcTftClassifier>
 {
@@ -87,8 +96,55 @@ public:
 
 protected:
 
+  /// The fields of a packet the TFTs are matched against
+  struct FlowKey
+  {
+    Ipv6Address remoteAddress; ///< remote address (IPv4-mapped for IPv4 packets)
+    Ipv6Address localAddress;  ///< local address (IPv4-mapped for IPv4 packets)
+    uint16_t protocolNumber;   ///< IPv4 or IPv6 protocol number
+    uint16_t remotePort;       ///< remote port
+    uint16_t localPort;        ///< local port
+    uint8_t direction;         ///< EPC TFT direction
+    uint8_t tos;               ///< type of service
+
+    /**
+     * \param other the key to compare with
+     * \return true if the two keys are equal
+     */
+    bool operator== (const FlowKey &other) const
+    {
+      return localPort == other.localPort && remotePort == other.remotePort
+             && tos == other.tos && direction == other.direction
+             && protocolNumber == other.protocolNumber
+             && localAddress == other.localAddress && remoteAddress == other.remoteAddress;
+    }
+  };
+
+  /// Hash function for FlowKey
+  struct FlowKeyHash
+  {
+    /**
+     * \param key the key
+     * \return the hash of the key
+     */
+    size_t operator() (const FlowKey &key) const
+    {
+      Ipv6AddressHash addressHash;
+      size_t h = addressHash (key.localAddress) ^ (addressHash (key.remoteAddress) * 31);
+      return h ^ ((static_cast<size_t> (key.localPort) << 16) | key.remotePort) ^ (key.tos << 8) ^ key.direction;
+    }
+  };
+
+  /// Classification result (TFT ID, 0 if no match) of each flow
+  typedef std::unordered_map<FlowKey, uint32_t, FlowKeyHash> FlowCache;
+
+  /// Number of cached flows above which the cache is flushed
+  static const uint32_t MAX_CACHED_FLOWS;
+
   std::map <uint32_t, Ptr<EpcTft> > m_tftMap; ///< TFT map
 
+  FlowCache m_flowCache; ///< classification result of the flows seen so far
+
   std::map < std::tuple<uint32_t, uint32_t, uint8_t, uint16_t>,
              std::pair<uint32_t, uint32_t> >
       m_classifiedIpv4Fragments; ///< Map with already classified IPv4 Fragments
@@ -146,6 +146,25 @@ static const std::string & ToString (UeManager::State s)
   return g_ueManagerStateName[s];
 }
 
+/**
+ * Compare two cells for the secondary cell selection, the cell with the
+ * highest SINR wins and ties go to the lowest cell id. A cell with a
+ * non-positive SINR never wins.
+ * \param cellA the first cell
+ * \param sinrA the SINR of the first cell
+ * \param cellB the second cell, 0 if none
+ * \param sinrB the SINR of the second cell, 0 if none
+ * \return true if the first cell is better than the second one
+ */
+static bool IsBetterSinr (uint16_t cellA, double sinrA, uint16_t cellB, double sinrB)
+{
+  if (sinrA <= 0)
+    {
+      return false;
+    }
+  return sinrA > sinrB || (sinrA == sinrB && cellA < cellB);
+}
+
 
 NS_OBJECT_ENSURE_REGISTERED (UeManager);
 
@@ -387,6 +406,11 @@ TypeId UeManager::GetTypeId (void)
                       "fired upon receiving RecvRlcSetupRequest",
                       MakeTraceSourceAccessor (&UeManager::m_secondaryRlcCreatedTrace),
                       "ns3::UeManager::ImsiCidRntiTracedCallback")
+     .AddTraceSource ("X2Forwarding",
+                      "fired when the RLC buffers of a bearer are forwarded "
+                      "to another cell",
+                      MakeTraceSourceAccessor (&UeManager::m_x2ForwardingTrace),
+                      "ns3::UeManager::X2ForwardingTracedCallback")
   ;
   return tid;
 }
@@ -748,12 +772,13 @@ UeManager::PrepareHandover (uint16_t cellId)
  * Merge 2 buffers of RlcAmPdus into 1 vector with increment order of Pdus
  */
 std::vector < LteRlcAm::RetxPdu >
-UeManager::MergeBuffers(std::vector < LteRlcAm::RetxPdu > first, std::vector < LteRlcAm::RetxPdu > second)
+UeManager::MergeBuffers(const std::vector < LteRlcAm::RetxPdu > &first, const std::vector < LteRlcAm::RetxPdu > &second)
 {
   LteRlcAmHeader rlcamHeader_1, rlcamHeader_2;
   std::vector < LteRlcAm::RetxPdu> result;
-  std::vector < LteRlcAm::RetxPdu>::iterator it_1 = first.begin();
-  std::vector < LteRlcAm::RetxPdu>::iterator it_2 = second.begin();
+  result.reserve (first.size () + second.size ());
+  std::vector < LteRlcAm::RetxPdu>::const_iterator it_1 = first.begin();
+  std::vector < LteRlcAm::RetxPdu>::const_iterator it_2 = second.begin();
   bool end_1_reached = false;
   bool end_2_reached = false;
   while (it_1 != first.end() && it_2 != second.end()){
@@ -1050,7 +1075,15 @@ UeManager::ForwardRlcBuffers(Ptr<LteRlc> rlc, Ptr<LtePdcp> pdcp, uint32_t gtpTei
     NS_ASSERT_MSG(mcPdcp->GetUseMmWaveConnection(), "The McEnbPdcp is not forwarding data to the mmWave eNB, check if the switch happened!");
   }
 
-  while (!m_x2forwardingBuffer.empty())
+  // walk the buffer once, instead of erasing every SDU from the front
+  // of the vector
+  std::vector < Ptr<Packet> > forwardingBuffer;
+  forwardingBuffer.swap (m_x2forwardingBuffer);
+  uint32_t forwardedSdus = 0;
+  uint64_t forwardedBytes = 0;
+  for (std::vector < Ptr<Packet> >::const_iterator sduIt = forwardingBuffer.begin ();
+       sduIt != forwardingBuffer.end ();
+       ++sduIt)
   {
     NS_LOG_DEBUG(this << " Forwarding m_x2forwardingBuffer to target eNB, gtpTeid = " << gtpTeid );
     EpcX2Sap::UeDataParams params;
@@ -1058,8 +1091,9 @@ UeManager::ForwardRlcBuffers(Ptr<LteRlc> rlc, Ptr<LtePdcp> pdcp, uint32_t gtpTei
     params.targetCellId = m_targetCellId;
     params.gtpTeid = gtpTeid;
     //Remove tags to get PDCP SDU from PDCP PDU.
-    //Ptr<Packet> rlcSdu =  (*(m_x2forwardingBuffer.begin()))->Copy();
-    Ptr<Packet> rlcSdu =  m_x2forwardingBuffer.at(0);
+    // the RLC entity still holds the same packets, and may keep
+    // transmitting them until the UE leaves: strip tags and headers from a copy
+    Ptr<Packet> rlcSdu =  (*sduIt)->Copy ();
     //Tags to be removed from rlcSdu (from outer to inner)
     //LteRlcSduStatusTag rlcSduStatusTag;
     //RlcTag  rlcTag; //rlc layer timestamp
@@ -1076,6 +1110,9 @@ UeManager::ForwardRlcBuffers(Ptr<LteRlc> rlc, Ptr<LtePdcp> pdcp, uint32_t gtpTei
       rlcSdu->PeekHeader(pdcpHeader);
       if (pdcpHeader.GetDcBit() == 1 )
       { //ignore control SDU.
+        // count the PDCP SDU alone, whether or not the branch below
+        // strips the PDCP header
+        uint32_t sduBytes = rlcSdu->GetSize () - pdcpHeader.GetSerializedSize ();
         NS_LOG_LOGIC ("SEQ = " << pdcpHeader.GetSequenceNumber());
         NS_LOG_LOGIC ("removed pdcp header, size = " << rlcSdu->GetSize());
 
@@ -1130,16 +1167,24 @@ UeManager::ForwardRlcBuffers(Ptr<LteRlc> rlc, Ptr<LtePdcp> pdcp, uint32_t gtpTei
           pdcpParams.lcid = Bid2Lcid (bid);
           mcPdcp->GetLtePdcpSapProvider()->TransmitPdcpSdu(pdcpParams);
         }
+        ++forwardedSdus;
+        forwardedBytes += sduBytes;
       }
     }
     else
     {
       NS_LOG_UNCOND("Too small, not forwarded");
     }
-    m_x2forwardingBufferSize -= (*(m_x2forwardingBuffer.begin()))->GetSize();
-    m_x2forwardingBuffer.erase (m_x2forwardingBuffer.begin());
+    m_x2forwardingBufferSize -= rlcSdu->GetSize();
     NS_LOG_LOGIC(this << " After forwarding: buffer size = " << m_x2forwardingBufferSize );
   }
+
+  if (forwardedSdus > 0)
+  {
+    m_x2ForwardingTrace (m_imsi, m_rrc->m_cellId, m_rnti,
+                         mcLteToMmWaveForwarding ? m_mmWaveCellId : m_targetCellId,
+                         forwardedSdus, forwardedBytes);
+  }
 }
 
 
@@ -2694,6 +2739,7 @@ LteEnbRrc::LteEnbRrc ()
   m_cphySapUser.push_back (new MemberLteEnbCphySapUser<LteEnbRrc> (this));
 
   m_imsiCellSinrMap.clear();
+  m_imsiSinrRankingMap.clear();
   m_x2_received_cnt = 0;
   m_switchEnabled = true;
   m_lteCellId = 0;
@@ -2989,6 +3035,11 @@ LteEnbRrc::GetTypeId (void)
             BooleanValue (true),
             MakeBooleanAccessor (&LteEnbRrc::m_reportAllUeMeas),
             MakeBooleanChecker ())
+   .AddAttribute ("PingPongTime",
+            "A UE handed over back to the cell it left within this time is counted as a ping-pong in the HandoverDecision trace",
+            TimeValue (Seconds (1)),
+            MakeTimeAccessor (&LteEnbRrc::m_pingPongTime),
+            MakeTimeChecker ())
     // Trace sources
     .AddTraceSource ("NewUeContext",
                      "Fired upon creation of a new UE context.",
@@ -3018,6 +3069,10 @@ LteEnbRrc::GetTypeId (void)
                   "trace fired when measurement report is received from mmWave cells, for each cell, for each UE",
                   MakeTraceSourceAccessor (&LteEnbRrc::m_notifyMmWaveSinrTrace),
                 "ns3::LteEnbRrc::NotifyMmWaveSinrTracedCallback")
+    .AddTraceSource ("HandoverDecision",
+                     "trace fired when a secondary cell handover is decided",
+                     MakeTraceSourceAccessor (&LteEnbRrc::m_handoverDecisionTrace),
+                     "ns3::LteEnbRrc::HandoverDecisionTracedCallback")
   ;
   return tid;
 }
@@ -3467,6 +3522,7 @@ LteEnbRrc::ConfigureCell (std::map<uint8_t, Ptr<ComponentCarrierEnb>> ccPhyConf)
    */
   Simulator::Schedule (MilliSeconds (16), &LteEnbRrc::SendSystemInformation, this);
   m_imsiCellSinrMap.clear();
+  m_imsiSinrRankingMap.clear();
   m_firstReport = true;
   m_configured = true;
 
@@ -3558,6 +3614,7 @@ LteEnbRrc::ConfigureCell (std::map<uint8_t, MmWaveComponentCarrierConf> ccPhyCon
    // mmWave module: Changed scheduling of initial system information to +2ms
   Simulator::Schedule (MilliSeconds (m_firstSibTime), &LteEnbRrc::SendSystemInformation, this);
   m_imsiCellSinrMap.clear();
+  m_imsiSinrRankingMap.clear();
   m_firstReport = true;
   m_configured = true;
 
@@ -3665,16 +3722,9 @@ LteEnbRrc::DoRecvUeSinrUpdate(EpcX2SapUser::UeImsiSinrParams params)
   NS_LOG_FUNCTION(this);
   NS_LOG_LOGIC("Recv Ue SINR Update from cell " << params.sourceCellId);
   uint16_t mmWaveCellId = params.sourceCellId;
-  if(m_cellSinrMap.find(mmWaveCellId) != m_cellSinrMap.end())
-  {     // update the entry
-    m_cellSinrMap[mmWaveCellId] = params.ueImsiSinrMap;
-    m_numNewSinrReports++;
-  }
-  else  // add the entry
-  {
-    m_cellSinrMap.insert(std::pair<uint16_t, ImsiSinrMap> (mmWaveCellId, params.ueImsiSinrMap));
-    m_numNewSinrReports++;
-  }
+  // add or update the entry
+  m_cellSinrMap[mmWaveCellId] = params.ueImsiSinrMap;
+  m_numNewSinrReports++;
   // cycle on all the Imsi whose SINR is known in cell mmWaveCellId
   for(std::map<uint64_t, double>::iterator imsiIter = params.ueImsiSinrMap.begin(); imsiIter != params.ueImsiSinrMap.end(); ++imsiIter)
   {
@@ -3685,33 +3735,23 @@ LteEnbRrc::DoRecvUeSinrUpdate(EpcX2SapUser::UeImsiSinrParams params)
 
     NS_LOG_LOGIC("Imsi " << imsi << " sinr " << sinr);
 
-    if(m_imsiCellSinrMap.find(imsi) != m_imsiCellSinrMap.end())
-    {
-      if(m_imsiCellSinrMap[imsi].find(mmWaveCellId) != m_imsiCellSinrMap[imsi].end())
-      {
-        // update the SINR measure
-        m_imsiCellSinrMap[imsi].find(mmWaveCellId)->second = sinr;
-      }
-      else // new cell for this Imsi
-      {
-        // insert a new SINR measure
-        m_imsiCellSinrMap[imsi].insert(std::pair<uint16_t, double>(mmWaveCellId, sinr));
-      }
-    }
-    else // new imsi
-    {
-      CellSinrMap map;
-      map.insert(std::pair<uint16_t, double>(mmWaveCellId, sinr));
-      m_imsiCellSinrMap.insert(std::pair<uint64_t, CellSinrMap> (imsi, map));
-    }
+    // insert or update the SINR measure, then only the ranking
+    // of this imsi needs to be updated
+    CellSinrMap &cellSinrMap = m_imsiCellSinrMap[imsi];
+    cellSinrMap[mmWaveCellId] = sinr;
+    UpdateSinrRanking (imsi, mmWaveCellId, sinr, cellSinrMap);
   }
 
-  for(std::map<uint64_t, CellSinrMap>::iterator imsiIter = m_imsiCellSinrMap.begin(); imsiIter != m_imsiCellSinrMap.end(); ++imsiIter)
+  // dumping the whole table is quadratic, do it only when it is printed
+  if (g_log.IsEnabled (LOG_LOGIC))
   {
-    NS_LOG_LOGIC("Imsi " << imsiIter->first);
-    for(CellSinrMap::iterator cellIter = imsiIter->second.begin(); cellIter != imsiIter->second.end(); ++cellIter)
+    for(std::map<uint64_t, CellSinrMap>::iterator imsiIter = m_imsiCellSinrMap.begin(); imsiIter != m_imsiCellSinrMap.end(); ++imsiIter)
     {
-      NS_LOG_LOGIC("mmWaveCell " << cellIter->first << " sinr " <<  cellIter->second);
+      NS_LOG_LOGIC("Imsi " << imsiIter->first);
+      for(CellSinrMap::iterator cellIter = imsiIter->second.begin(); cellIter != imsiIter->second.end(); ++cellIter)
+      {
+        NS_LOG_LOGIC("mmWaveCell " << cellIter->first << " sinr " <<  cellIter->second);
+      }
     }
   }
 
@@ -3798,6 +3838,7 @@ LteEnbRrc::TttBasedHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
         params.imsi = imsi;
         params.targetCellId = maxSinrCellId;
         params.oldCellId = m_lastMmWaveCell[imsi];
+        NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
         m_x2SapProvider->SendMcHandoverRequest(params);
 
         m_mmWaveCellSetupCompleted[imsi] = false;
@@ -3811,6 +3852,7 @@ LteEnbRrc::TttBasedHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter,
         m_mmWaveCellSetupCompleted[imsi] = false;
         m_bestMmWaveCellForImsiMap[imsi] = maxSinrCellId;
         NS_LOG_INFO("---- on LTE, handover to MmWave " << maxSinrCellId << " at time " << Simulator::Now().GetSeconds());
+        NotifyHandoverDecision(imsi, m_cellId, maxSinrCellId);
         SendHandoverRequest(GetRntiFromImsi(imsi), maxSinrCellId);
       }
     }
@@ -3998,6 +4040,7 @@ LteEnbRrc::PerformHandover(uint64_t imsi)
       params.imsi = imsi;
       params.targetCellId = handoverInfo.targetCellId;
       params.oldCellId = m_lastMmWaveCell[imsi];
+      NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
       m_x2SapProvider->SendMcHandoverRequest(params);
 
       m_mmWaveCellSetupCompleted[imsi] = false;
@@ -4058,6 +4101,7 @@ LteEnbRrc::ThresholdBasedSecondaryCellHandover(std::map<uint64_t, CellSinrMap>::
       params.imsi = imsi;
       params.targetCellId = maxSinrCellId;
       params.oldCellId = m_lastMmWaveCell[imsi];
+      NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
       m_x2SapProvider->SendMcHandoverRequest(params);
 
       m_mmWaveCellSetupCompleted[imsi] = false; // TODO check this bool
@@ -4097,6 +4141,7 @@ LteEnbRrc::ThresholdBasedSecondaryCellHandover(std::map<uint64_t, CellSinrMap>::
       params.imsi = imsi;
       params.targetCellId = maxSinrCellId;
       params.oldCellId = m_lastMmWaveCell[imsi];
+      NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
       m_x2SapProvider->SendMcHandoverRequest(params);
 
       m_mmWaveCellSetupCompleted[imsi] = false;
@@ -4116,6 +4161,7 @@ LteEnbRrc::ThresholdBasedSecondaryCellHandover(std::map<uint64_t, CellSinrMap>::
       params.imsi = imsi;
       params.targetCellId = maxSinrCellId;
       params.oldCellId = m_lastMmWaveCell[imsi];
+      NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
       m_x2SapProvider->SendMcHandoverRequest(params);
 
       m_mmWaveCellSetupCompleted[imsi] = false;
@@ -4161,18 +4207,15 @@ LteEnbRrc::TriggerUeAssociationUpdate()
       }
       NS_LOG_INFO("alreadyAssociatedImsi " << alreadyAssociatedImsi << " onHandoverImsi " << onHandoverImsi);
 
-      for(CellSinrMap::iterator cellIter = imsiIter->second.begin(); cellIter != imsiIter->second.end(); ++cellIter)
+      // the best cell is kept up to date by DoRecvUeSinrUpdate
+      std::unordered_map<uint64_t, SinrRanking>::const_iterator ranking = m_imsiSinrRankingMap.find(imsi);
+      NS_ASSERT_MSG(ranking != m_imsiSinrRankingMap.end(), "No SINR ranking for imsi " << imsi);
+      maxSinr = ranking->second.bestSinr;
+      maxSinrCellId = ranking->second.bestCellId;
+      CellSinrMap::const_iterator currentCell = imsiIter->second.find(m_lastMmWaveCell[imsi]);
+      if(currentCell != imsiIter->second.end())
       {
-        NS_LOG_INFO("Cell " << cellIter->first << " reports " << 10*std::log10(cellIter->second));
-        if(cellIter->second > maxSinr)
-        {
-          maxSinr = cellIter->second;
-          maxSinrCellId = cellIter->first;
-        }
-        if(m_lastMmWaveCell[imsi] == cellIter->first)
-        {
-          currentSinr = cellIter->second;
-        }
+        currentSinr = currentCell->second;
       }
       long double sinrDifference = std::abs(10*(std::log10((long double)maxSinr) - std::log10((long double)currentSinr)));
       long double maxSinrDb = 10*std::log10((long double)maxSinr);
@@ -4267,6 +4310,7 @@ LteEnbRrc::ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::itera
       params.imsi = imsi;
       params.targetCellId = maxSinrCellId;
       params.oldCellId = m_lastMmWaveCell[imsi];
+      NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
       m_x2SapProvider->SendMcHandoverRequest(params);
 
       m_mmWaveCellSetupCompleted[imsi] = false;
@@ -4287,6 +4331,7 @@ LteEnbRrc::ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::itera
       m_mmWaveCellSetupCompleted[imsi] = false;
       m_bestMmWaveCellForImsiMap[imsi] = maxSinrCellId;
       NS_LOG_INFO("Handover to MmWave " << m_bestMmWaveCellForImsiMap.at(imsi));
+      NotifyHandoverDecision(imsi, m_cellId, maxSinrCellId);
       SendHandoverRequest(GetRntiFromImsi(imsi), m_bestMmWaveCellForImsiMap.at(imsi));
     }
     else if (!m_imsiUsingLte[imsi] && alreadyAssociatedImsi && !onHandoverImsi && m_lastMmWaveCell[imsi] != maxSinrCellId && sinrDifference > m_sinrThresholdDifference) // not on LTE, handover between MmWave cells
@@ -4297,6 +4342,7 @@ LteEnbRrc::ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::itera
       params.imsi = imsi;
       params.targetCellId = maxSinrCellId;
       params.oldCellId = m_lastMmWaveCell[imsi];
+      NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
       m_x2SapProvider->SendMcHandoverRequest(params);
 
       m_mmWaveCellSetupCompleted[imsi] = false;
@@ -4310,6 +4356,110 @@ LteEnbRrc::ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::itera
   }
 }
 
+void
+LteEnbRrc::UpdateSinrRanking (uint64_t imsi, uint16_t cellId, double sinr, const CellSinrMap &cellSinrMap)
+{
+  NS_LOG_FUNCTION (this << imsi << cellId << sinr);
+  SinrRanking &ranking = m_imsiSinrRankingMap[imsi];
+  uint16_t previousBestCellId = ranking.bestCellId;
+  if (cellId == ranking.bestCellId)
+    {
+      if (IsBetterSinr (cellId, sinr, ranking.secondCellId, ranking.secondSinr))
+        {
+          ranking.bestSinr = sinr;
+        }
+      else
+        {
+          // the best cell lost its position, but the new best may be a
+          // cell which is not tracked
+          RankCells (cellSinrMap, ranking);
+        }
+    }
+  else if (cellId == ranking.secondCellId)
+    {
+      if (IsBetterSinr (cellId, sinr, ranking.bestCellId, ranking.bestSinr))
+        {
+          ranking.secondCellId = ranking.bestCellId;
+          ranking.secondSinr = ranking.bestSinr;
+          ranking.bestCellId = cellId;
+          ranking.bestSinr = sinr;
+        }
+      else if (sinr >= ranking.secondSinr)
+        {
+          ranking.secondSinr = sinr;
+        }
+      else
+        {
+          RankCells (cellSinrMap, ranking);
+        }
+    }
+  else if (IsBetterSinr (cellId, sinr, ranking.bestCellId, ranking.bestSinr))
+    {
+      ranking.secondCellId = ranking.bestCellId;
+      ranking.secondSinr = ranking.bestSinr;
+      ranking.bestCellId = cellId;
+      ranking.bestSinr = sinr;
+    }
+  else if (IsBetterSinr (cellId, sinr, ranking.secondCellId, ranking.secondSinr))
+    {
+      ranking.secondCellId = cellId;
+      ranking.secondSinr = sinr;
+    }
+
+  if (ranking.bestCellId != previousBestCellId)
+    {
+      ranking.bestSince = Simulator::Now ();
+    }
+}
+
+void
+LteEnbRrc::RankCells (const CellSinrMap &cellSinrMap, SinrRanking &ranking)
+{
+  ranking.bestCellId = 0;
+  ranking.bestSinr = 0;
+  ranking.secondCellId = 0;
+  ranking.secondSinr = 0;
+  for (CellSinrMap::const_iterator cellIter = cellSinrMap.begin (); cellIter != cellSinrMap.end (); ++cellIter)
+    {
+      if (IsBetterSinr (cellIter->first, cellIter->second, ranking.bestCellId, ranking.bestSinr))
+        {
+          ranking.secondCellId = ranking.bestCellId;
+          ranking.secondSinr = ranking.bestSinr;
+          ranking.bestCellId = cellIter->first;
+          ranking.bestSinr = cellIter->second;
+        }
+      else if (IsBetterSinr (cellIter->first, cellIter->second, ranking.secondCellId, ranking.secondSinr))
+        {
+          ranking.secondCellId = cellIter->first;
+          ranking.secondSinr = cellIter->second;
+        }
+    }
+}
+
+void
+LteEnbRrc::NotifyHandoverDecision (uint64_t imsi, uint16_t sourceCellId, uint16_t targetCellId)
+{
+  NS_LOG_FUNCTION (this << imsi << sourceCellId << targetCellId);
+  Time decisionDelay = Seconds (0);
+  std::unordered_map<uint64_t, SinrRanking>::const_iterator ranking = m_imsiSinrRankingMap.find (imsi);
+  if (ranking != m_imsiSinrRankingMap.end () && ranking->second.bestCellId == targetCellId)
+    {
+      decisionDelay = Simulator::Now () - ranking->second.bestSince;
+    }
+
+  bool pingPong = false;
+  HandoverDecisionInfo &lastDecision = m_lastHandoverDecisionMap[imsi];
+  if (lastDecision.sourceCellId == targetCellId && targetCellId != 0
+      && Simulator::Now () - lastDecision.time <= m_pingPongTime)
+    {
+      pingPong = true;
+    }
+  lastDecision.sourceCellId = sourceCellId;
+  lastDecision.time = Simulator::Now ();
+
+  m_handoverDecisionTrace (imsi, sourceCellId, targetCellId, decisionDelay, pingPong);
+}
+
 void
 LteEnbRrc::EnableSwitching(uint64_t imsi)
 {
@@ -4347,18 +4497,15 @@ LteEnbRrc::UpdateUeHandoverAssociation()
       }
       NS_LOG_INFO("alreadyAssociatedImsi " << alreadyAssociatedImsi << " onHandoverImsi " << onHandoverImsi);
 
-      for(CellSinrMap::iterator cellIter = imsiIter->second.begin(); cellIter != imsiIter->second.end(); ++cellIter)
+      // the best cell is kept up to date by DoRecvUeSinrUpdate
+      std::unordered_map<uint64_t, SinrRanking>::const_iterator ranking = m_imsiSinrRankingMap.find(imsi);
+      NS_ASSERT_MSG(ranking != m_imsiSinrRankingMap.end(), "No SINR ranking for imsi " << imsi);
+      maxSinr = ranking->second.bestSinr;
+      maxSinrCellId = ranking->second.bestCellId;
+      CellSinrMap::const_iterator currentCell = imsiIter->second.find(m_lastMmWaveCell[imsi]);
+      if(currentCell != imsiIter->second.end())
       {
-        NS_LOG_INFO("Cell " << cellIter->first << " reports " << 10*std::log10(cellIter->second));
-        if(cellIter->second > maxSinr)
-        {
-          maxSinr = cellIter->second;
-          maxSinrCellId = cellIter->first;
-        }
-        if(m_lastMmWaveCell[imsi] == cellIter->first)
-        {
-          currentSinr = cellIter->second;
-        }
+        currentSinr = currentCell->second;
       }
 
       long double sinrDifference = std::abs(10*(std::log10((long double)maxSinr) - std::log10((long double)currentSinr)));
@@ -4384,6 +4531,7 @@ LteEnbRrc::UpdateUeHandoverAssociation()
             params.targetCellId = m_cellId;
             params.oldCellId = m_lastMmWaveCell[imsi];
             m_mmWaveCellSetupCompleted.find(imsi)->second = false;
+            NotifyHandoverDecision(imsi, params.oldCellId, params.targetCellId);
             m_x2SapProvider->SendMcHandoverRequest(params);
           }
           else
@@ -57,6 +57,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <ns3/component-carrier-enb.h>
 #include <vector>
 
@@ -413,6 +414,21 @@ public:
     typedef void (* ImsiCidRntiTracedCallback)
       (uint64_t imsi, uint16_t cellId, uint16_t rnti);
 
+    /**
+     * TracedCallback signature for the forwarding of the RLC buffers of a bearer.
+     *
+     * \param [in] imsi
+     * \param [in] cellId
+     * \param [in] rnti
+     * \param [in] targetCellId the cell the buffers are forwarded to
+     * \param [in] sdus the number of forwarded SDUs
+     * \param [in] bytes the size of the forwarded PDCP SDUs, in bytes,
+     *                   without their PDCP header
+     */
+    typedef void (* X2ForwardingTracedCallback)
+      (uint64_t imsi, uint16_t cellId, uint16_t rnti, uint16_t targetCellId,
+       uint32_t sdus, uint64_t bytes);
+
     // for interRatHandover mode
     void SetFirstConnection();
 
@@ -446,7 +462,7 @@ public:
 
 private:
   //Lossless HO: merge 2 buffers into 1 with increment order.
-  std::vector < LteRlcAm::RetxPdu > MergeBuffers(std::vector < LteRlcAm::RetxPdu > first, std::vector < LteRlcAm::RetxPdu > second);
+  std::vector < LteRlcAm::RetxPdu > MergeBuffers(const std::vector < LteRlcAm::RetxPdu > &first, const std::vector < LteRlcAm::RetxPdu > &second);
   /**
    * Forward the content of RLC buffers. For RLC UM and UM LowLat, forward txBuffer.
    * For RLC AM, forward the merge of retx and txed buffers, and txBuffer
@@ -636,6 +652,14 @@ private:
    */
   TracedCallback<uint64_t, uint16_t, uint16_t> m_secondaryRlcCreatedTrace;
 
+  /**
+   * The `X2Forwarding` trace source. Fired each time the RLC buffers of a
+   * bearer are forwarded during a handover or a switch between the LTE and
+   * mmWave cells. Exporting IMSI, cellId, RNTI, target cellId, number of
+   * forwarded SDUs and their size in bytes, PDCP headers excluded.
+   */
+  TracedCallback<uint64_t, uint16_t, uint16_t, uint16_t, uint32_t, uint64_t> m_x2ForwardingTrace;
+
   uint16_t m_sourceX2apId;
   uint16_t m_sourceCellId;
   uint16_t m_targetCellId;
@@ -1240,6 +1264,21 @@ public:
    typedef void (* NotifyMmWaveSinrTracedCallback)
      (uint64_t imsi, uint16_t cellId, long double sinr);
 
+   /**
+    * TracedCallback signature for secondary cell handover decisions.
+    *
+    * \param [in] imsi
+    * \param [in] sourceCellId the cell the UE is leaving
+    * \param [in] targetCellId the cell the UE is moving to
+    * \param [in] decisionDelay time elapsed since the target cell became
+    *             the best ranked mmWave cell, zero if it is not
+    * \param [in] pingPong true if the UE goes back to the cell it left with
+    *             its previous handover, within the PingPongTime
+    */
+   typedef void (* HandoverDecisionTracedCallback)
+     (uint64_t imsi, uint16_t sourceCellId, uint16_t targetCellId,
+      Time decisionDelay, bool pingPong);
+
    /**
     * Different secondary cell handover modes
     */
@@ -1262,6 +1301,37 @@ public:
     */
    typedef std::map<uint64_t, HandoverEventInfo> HandoverEventMap;
 
+   /**
+    * The two mmWave cells with the highest SINR for a UE, kept up to date
+    * as the SINR reports are received. Cells with a non-positive SINR are
+    * never ranked, a cell id of 0 means no cell. Ties go to the lowest
+    * cell id.
+    */
+   struct SinrRanking
+   {
+     SinrRanking ()
+       : bestCellId (0),
+         bestSinr (0),
+         secondCellId (0),
+         secondSinr (0)
+     {
+     }
+     uint16_t bestCellId;   ///< cell with the highest SINR
+     double bestSinr;       ///< SINR of bestCellId
+     uint16_t secondCellId; ///< cell with the second highest SINR
+     double secondSinr;     ///< SINR of secondCellId
+     Time bestSince;        ///< time at which bestCellId became the best cell
+   };
+
+   /**
+    * The last secondary cell handover decided for a UE
+    */
+   struct HandoverDecisionInfo
+   {
+     uint16_t sourceCellId; ///< the cell the UE left
+     Time time;             ///< time of the decision
+   };
+
    /**
     * This method maps Imsi to Rnti, so that the UeManager of a certain UE
     * can be retrieved also with the Imsi
@@ -1671,6 +1741,31 @@ private:
    */
   void ThresholdBasedInterRatHandover(std::map<uint64_t, CellSinrMap>::iterator imsiIter, double sinrDifference, uint16_t maxSinrCellId, double maxSinrDb);
 
+  /**
+   * Update the SinrRanking of a UE after a new SINR report
+   * \param imsi the IMSI of the UE
+   * \param cellId the cell which reported the SINR
+   * \param sinr the reported SINR
+   * \param cellSinrMap the SINR of every cell for this UE, already updated
+   *        with the new report
+   */
+  void UpdateSinrRanking (uint64_t imsi, uint16_t cellId, double sinr, const CellSinrMap &cellSinrMap);
+
+  /**
+   * Recompute a SinrRanking from scratch
+   * \param cellSinrMap the SINR of every cell for the UE
+   * \param ranking the ranking to recompute
+   */
+  static void RankCells (const CellSinrMap &cellSinrMap, SinrRanking &ranking);
+
+  /**
+   * Fire the HandoverDecision trace
+   * \param imsi the IMSI of the UE
+   * \param sourceCellId the cell the UE is leaving
+   * \param targetCellId the cell the UE is moving to
+   */
+  void NotifyHandoverDecision (uint64_t imsi, uint16_t sourceCellId, uint16_t targetCellId);
+
   Callback <void, Ptr<Packet> > m_forwardUpCallback;  ///< forward up callback function
 
   /// Interface to receive messages from neighbour eNodeB over the X2 interface.
@@ -1895,6 +1990,13 @@ private:
 
   TracedCallback<uint64_t, uint16_t, long double> m_notifyMmWaveSinrTrace;
 
+  /**
+   * The `HandoverDecision` trace source. Fired when the LTE coordinator
+   * decides a secondary cell handover. Exporting IMSI, source and target
+   * cell ID, decision delay and whether it is a ping-pong.
+   */
+  TracedCallback<uint64_t, uint16_t, uint16_t, Time, bool> m_handoverDecisionTrace;
+
   //mc
   bool m_ismmWave;
   bool m_interRatHoMode;
@@ -1914,6 +2016,9 @@ private:
   std::map<uint64_t, bool> m_mmWaveCellSetupCompleted;
   std::map<uint64_t, bool> m_imsiUsingLte;
   std::map<uint64_t, CellSinrMap> m_imsiCellSinrMap;
+  std::unordered_map<uint64_t, SinrRanking> m_imsiSinrRankingMap; ///< best cells of each UE in m_imsiCellSinrMap
+  std::unordered_map<uint64_t, HandoverDecisionInfo> m_lastHandoverDecisionMap; ///< last handover decision of each UE
+  Time m_pingPongTime; ///< a UE going back to its previous cell within this time is a ping-pong
   std::map<uint64_t, uint16_t> m_imsiRntiMap;
   std::map<uint16_t, uint64_t> m_rntiImsiMap;
 
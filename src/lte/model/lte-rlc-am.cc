@@ -715,7 +715,7 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
   }
 
 
-  Ptr<Packet> packet = Create<Packet> ();
+  Ptr<Packet> packet;
   LteRlcAmHeader rlcAmHeader;
   rlcAmHeader.SetDataPdu ();
 
@@ -747,7 +747,9 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
     m_txonBufferSize += tempP->GetSize ();
   }
 
-  Ptr<Packet> firstSegment = (*(m_txonBuffer.begin ()))->Copy ();
+  // The SDU leaves the transmission buffer below, hence it can be
+  // segmented in place rather than copied
+  Ptr<Packet> firstSegment = *(m_txonBuffer.begin ());
 
   // LL HO
   // tricky: store the incomplete Rlc SDU for forwarding to
@@ -939,7 +941,7 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
             m_txonBufferSize += tempP->GetSize ();
           }
 
-          firstSegment = (*(m_txonBuffer.begin ()))->Copy ();
+          firstSegment = *(m_txonBuffer.begin ());
 
           // LL HO
           // New complete SDU is taken from txonBuffer so reset the
@@ -1004,17 +1006,8 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
     }
   (*it)->AddPacketTag (tag);
 
-  // Add all SDUs (in DataField) to the Packet
-  while (it < dataField.end ())
-    {
-      NS_LOG_LOGIC ("Adding SDU/segment to packet, length = " << (*it)->GetSize ());
-
-      packet->AddAtEnd (*it);
-      it++;
-    }
-
   // LAST SEGMENT (Note: There could be only one and be the first one)
-  it--;
+  it = dataField.end () - 1;
   (*it)->RemovePacketTag (tag);
   if ( (tag.GetStatus () == LteRlcSduStatusTag::FULL_SDU) ||
         (tag.GetStatus () == LteRlcSduStatusTag::LAST_SEGMENT) )
@@ -1027,6 +1020,21 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
     }
   (*it)->AddPacketTag (tag);
 
+  // Add all SDUs (in DataField) to the Packet. None of them is referenced
+  // by the transmission buffer anymore, hence the first one becomes the
+  // PDU itself and a PDU carrying a single SDU is not copied. Its packet
+  // tags are dropped, as AddAtEnd would have done.
+  it = dataField.begin ();
+  NS_LOG_LOGIC ("Adding SDU/segment to packet, length = " << (*it)->GetSize ());
+  packet = *it;
+  packet->RemoveAllPacketTags ();
+  for (it++; it != dataField.end (); it++)
+    {
+      NS_LOG_LOGIC ("Adding SDU/segment to packet, length = " << (*it)->GetSize ());
+
+      packet->AddAtEnd (*it);
+    }
+
   // Set the FramingInfo flag after the calculation
   rlcAmHeader.SetFramingInfo (framingInfo);
 
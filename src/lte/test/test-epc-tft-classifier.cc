@@ -211,6 +211,96 @@ EpcTftClassifierTestCase::DoRun (void)
 
 
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test case to check that adding or deleting a TFT changes the
+ * classification of a flow that the classifier has already seen.
+ */
+class EpcTftClassifierUpdateTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param useIpv6 use IPv6 or IPv4 addresses. If set, addresses will be used as IPv4 mapped addresses
+   */
+  EpcTftClassifierUpdateTestCase (bool useIpv6);
+
+private:
+  bool m_useIpv6; ///< use IPv4 or IPv6 header/addresses
+
+  /**
+   * Classify an uplink UDP packet from 2.2.3.4:4 to 1.1.1.1:1234
+   * \param c the EPC TFT classifier
+   * \returns the TFT ID
+   */
+  uint32_t Classify (Ptr<EpcTftClassifier> c);
+
+  virtual void DoRun (void);
+};
+
+EpcTftClassifierUpdateTestCase::EpcTftClassifierUpdateTestCase (bool useIpv6)
+  : TestCase (useIpv6 ? "Add and Delete reclassify a known IPv6 flow" : "Add and Delete reclassify a known IPv4 flow"),
+    m_useIpv6 (useIpv6)
+{
+}
+
+uint32_t
+EpcTftClassifierUpdateTestCase::Classify (Ptr<EpcTftClassifier> c)
+{
+  Ptr<Packet> udpPacket = Create<Packet> ();
+  UdpHeader udpHeader;
+  udpHeader.SetSourcePort (4);
+  udpHeader.SetDestinationPort (1234);
+  udpPacket->AddHeader (udpHeader);
+  if (m_useIpv6)
+    {
+      Ipv6Header ipv6Header;
+      ipv6Header.SetSourceAddress (Ipv6Address::MakeIpv4MappedAddress (Ipv4Address ("2.2.3.4")));
+      ipv6Header.SetDestinationAddress (Ipv6Address::MakeIpv4MappedAddress (Ipv4Address ("1.1.1.1")));
+      ipv6Header.SetPayloadLength (8); // Full UDP header
+      ipv6Header.SetNextHeader (UdpL4Protocol::PROT_NUMBER);
+      udpPacket->AddHeader (ipv6Header);
+    }
+  else
+    {
+      Ipv4Header ipHeader;
+      ipHeader.SetSource (Ipv4Address ("2.2.3.4"));
+      ipHeader.SetDestination (Ipv4Address ("1.1.1.1"));
+      ipHeader.SetPayloadSize (8); // Full UDP header
+      ipHeader.SetProtocol (UdpL4Protocol::PROT_NUMBER);
+      udpPacket->AddHeader (ipHeader);
+    }
+  return c->Classify (udpPacket, EpcTft::UPLINK,
+                      m_useIpv6 ? Ipv6L3Protocol::PROT_NUMBER : Ipv4L3Protocol::PROT_NUMBER);
+}
+
+void
+EpcTftClassifierUpdateTestCase::DoRun (void)
+{
+  Ptr<EpcTftClassifier> c = Create<EpcTftClassifier> ();
+  c->Add (EpcTft::Default (), 1);
+  NS_TEST_ASSERT_MSG_EQ (Classify (c), 1, "bad classification by the default TFT");
+  NS_TEST_ASSERT_MSG_EQ (Classify (c), 1, "bad classification of a known flow");
+
+  // a TFT with a higher ID takes precedence over the cached result
+  Ptr<EpcTft> tft = Create<EpcTft> ();
+  EpcTft::PacketFilter pf;
+  pf.remotePortStart = 1234;
+  pf.remotePortEnd   = 1234;
+  tft->Add (pf);
+  c->Add (tft, 3);
+  NS_TEST_ASSERT_MSG_EQ (Classify (c), 3, "known flow not reclassified after Add");
+
+  c->Delete (3);
+  NS_TEST_ASSERT_MSG_EQ (Classify (c), 1, "known flow not reclassified after Delete");
+
+  c->Delete (1);
+  NS_TEST_ASSERT_MSG_EQ (Classify (c), 0, "known flow still classified with no TFT left");
+}
+
 
 /**
  * \ingroup lte-test
@@ -429,5 +519,12 @@ EpcTftClassifierTestSuite::EpcTftClassifierTestSuite ()
       AddTestCase (new EpcTftClassifierTestCase (c4, EpcTft::UPLINK,   "9.1.1.1", "8.1.1.1",  7895,       10,     0,    1, useIpv6), TestCase::QUICK);
       AddTestCase (new EpcTftClassifierTestCase (c4, EpcTft::UPLINK,   "9.1.1.1", "8.1.1.1",     9,     5897,     0,    2, useIpv6), TestCase::QUICK);
       AddTestCase (new EpcTftClassifierTestCase (c4, EpcTft::DOWNLINK, "9.1.1.1", "8.1.1.1",  5897,       10,     0,    2, useIpv6), TestCase::QUICK);
+
+
+      ///////////////////////////////////////////
+      // check Add and Delete on known flows
+      ///////////////////////////////////////////
+
+      AddTestCase (new EpcTftClassifierUpdateTestCase (useIpv6), TestCase::QUICK);
     }
 }
@@ -592,6 +592,173 @@ LteX2HandoverTestCase::CheckStatsAWhileAfterHandover (uint32_t ueIndex)
 }
 
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test the X2Forwarding trace of the UeManager: the RLC buffers
+ * forwarded during a handover are counted as PDCP SDUs, without their
+ * PDCP header.
+ */
+class LteX2ForwardingTestCase : public TestCase
+{
+public:
+  LteX2ForwardingTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Connect the X2Forwarding trace of the UeManager of a UE at an eNB
+   * \param ueDevice the UE device
+   * \param enbDevice the eNB device
+   */
+  void ConnectForwardingTrace (Ptr<NetDevice> ueDevice, Ptr<NetDevice> enbDevice);
+
+  /**
+   * X2Forwarding trace sink
+   * \param imsi the IMSI
+   * \param cellId the source cell ID
+   * \param rnti the RNTI
+   * \param targetCellId the target cell ID
+   * \param sdus the number of forwarded SDUs
+   * \param bytes the number of forwarded bytes
+   */
+  void X2Forwarding (uint64_t imsi, uint16_t cellId, uint16_t rnti, uint16_t targetCellId,
+                     uint32_t sdus, uint64_t bytes);
+
+  uint64_t m_imsi; ///< IMSI of the last forwarding
+  uint16_t m_cellId; ///< source cell ID of the last forwarding
+  uint16_t m_targetCellId; ///< target cell ID of the last forwarding
+  uint32_t m_sdus; ///< number of forwarded SDUs
+  uint64_t m_bytes; ///< number of forwarded bytes
+  const uint32_t m_udpClientPktSize; ///< UDP client packet size
+};
+
+LteX2ForwardingTestCase::LteX2ForwardingTestCase ()
+  : TestCase ("X2Forwarding trace of a handover with RLC UM"),
+    m_imsi (0),
+    m_cellId (0),
+    m_targetCellId (0),
+    m_sdus (0),
+    m_bytes (0),
+    m_udpClientPktSize (1000)
+{
+}
+
+void
+LteX2ForwardingTestCase::ConnectForwardingTrace (Ptr<NetDevice> ueDevice, Ptr<NetDevice> enbDevice)
+{
+  uint16_t rnti = ueDevice->GetObject<LteUeNetDevice> ()->GetRrc ()->GetRnti ();
+  Ptr<UeManager> ueManager = enbDevice->GetObject<LteEnbNetDevice> ()->GetRrc ()->GetUeManager (rnti);
+  ueManager->TraceConnectWithoutContext ("X2Forwarding",
+                                         MakeCallback (&LteX2ForwardingTestCase::X2Forwarding, this));
+}
+
+void
+LteX2ForwardingTestCase::X2Forwarding (uint64_t imsi, uint16_t cellId, uint16_t rnti, uint16_t targetCellId,
+                                       uint32_t sdus, uint64_t bytes)
+{
+  m_imsi = imsi;
+  m_cellId = cellId;
+  m_targetCellId = targetCellId;
+  m_sdus += sdus;
+  m_bytes += bytes;
+}
+
+void
+LteX2ForwardingTestCase::DoRun (void)
+{
+  Config::Reset ();
+  // more DL traffic than the cell edge can carry, so that the RLC buffer
+  // is not empty at the handover
+  Config::SetDefault ("ns3::UdpClient::Interval", TimeValue (MicroSeconds (100)));
+  Config::SetDefault ("ns3::UdpClient::MaxPackets", UintegerValue (1000000));
+  Config::SetDefault ("ns3::UdpClient::PacketSize", UintegerValue (m_udpClientPktSize));
+  Config::SetDefault ("ns3::LteEnbRrc::EpsBearerToRlcMapping", EnumValue (LteEnbRrc::RLC_UM_ALWAYS));
+  Config::SetDefault ("ns3::LteUePhy::EnableUplinkPowerControl", BooleanValue (false));
+  Config::SetDefault ("ns3::PointToPointEpcHelper::S1apLinkDelay", TimeValue (Seconds (0)));
+
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetAttribute ("PathlossModel", StringValue ("ns3::FriisSpectrumPropagationLossModel"));
+  lteHelper->SetHandoverAlgorithmType ("ns3::NoOpHandoverAlgorithm");
+  lteHelper->SetEnbDeviceAttribute ("DlBandwidth", UintegerValue (25));
+  lteHelper->SetEnbDeviceAttribute ("UlBandwidth", UintegerValue (25));
+  Ptr<PointToPointEpcHelper> epcHelper = CreateObject<PointToPointEpcHelper> ();
+  lteHelper->SetEpcHelper (epcHelper);
+
+  NodeContainer enbNodes;
+  enbNodes.Create (2);
+  NodeContainer ueNodes;
+  ueNodes.Create (1);
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (-3000, 0, 0));
+  positionAlloc->Add (Vector ( 3000, 0, 0));
+  positionAlloc->Add (Vector (0, 0, 0));
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (enbNodes);
+  mobility.Install (ueNodes);
+
+  NetDeviceContainer enbDevices = lteHelper->InstallEnbDevice (enbNodes);
+  NetDeviceContainer ueDevices = lteHelper->InstallUeDevice (ueNodes);
+  lteHelper->AssignStreams (enbDevices, 1);
+  lteHelper->AssignStreams (ueDevices, 100);
+
+  NodeContainer remoteHostContainer;
+  remoteHostContainer.Create (1);
+  Ptr<Node> remoteHost = remoteHostContainer.Get (0);
+  InternetStackHelper internet;
+  internet.Install (remoteHostContainer);
+  PointToPointHelper p2ph;
+  p2ph.SetDeviceAttribute ("DataRate", DataRateValue (DataRate ("100Gb/s")));
+  p2ph.SetChannelAttribute ("Delay", TimeValue (MilliSeconds (10)));
+  NetDeviceContainer internetDevices = p2ph.Install (epcHelper->GetPgwNode (), remoteHost);
+  Ipv4AddressHelper ipv4h;
+  ipv4h.SetBase ("1.0.0.0", "255.0.0.0");
+  ipv4h.Assign (internetDevices);
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  ipv4RoutingHelper.GetStaticRouting (remoteHost->GetObject<Ipv4> ())
+    ->AddNetworkRouteTo (Ipv4Address ("7.0.0.0"), Ipv4Mask ("255.0.0.0"), 1);
+
+  internet.Install (ueNodes);
+  Ipv4InterfaceContainer ueIpIfaces = epcHelper->AssignUeIpv4Address (ueDevices);
+  ipv4RoutingHelper.GetStaticRouting (ueNodes.Get (0)->GetObject<Ipv4> ())
+    ->SetDefaultRoute (epcHelper->GetUeDefaultGatewayAddress (), 1);
+  lteHelper->Attach (ueDevices, enbDevices.Get (0));
+
+  uint16_t dlPort = 10000;
+  UdpClientHelper dlClientHelper (ueIpIfaces.GetAddress (0), dlPort);
+  ApplicationContainer clientApps = dlClientHelper.Install (remoteHost);
+  PacketSinkHelper dlPacketSinkHelper ("ns3::UdpSocketFactory",
+                                       InetSocketAddress (Ipv4Address::GetAny (), dlPort));
+  ApplicationContainer serverApps = dlPacketSinkHelper.Install (ueNodes.Get (0));
+  clientApps.Start (MilliSeconds (10));
+  serverApps.Start (MilliSeconds (10));
+
+  lteHelper->AddX2Interface (enbNodes);
+  Simulator::Schedule (MilliSeconds (190), &LteX2ForwardingTestCase::ConnectForwardingTrace,
+                       this, ueDevices.Get (0), enbDevices.Get (0));
+  lteHelper->HandoverRequest (MilliSeconds (200), ueDevices.Get (0), enbDevices.Get (0), enbDevices.Get (1));
+
+  Simulator::Stop (MilliSeconds (300));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_GT (m_sdus, 0, "No SDU forwarded");
+  NS_TEST_ASSERT_MSG_EQ (m_imsi, ueDevices.Get (0)->GetObject<LteUeNetDevice> ()->GetImsi (), "Wrong IMSI");
+  NS_TEST_ASSERT_MSG_EQ (m_cellId, enbDevices.Get (0)->GetObject<LteEnbNetDevice> ()->GetCellId (), "Wrong source cell");
+  NS_TEST_ASSERT_MSG_EQ (m_targetCellId, enbDevices.Get (1)->GetObject<LteEnbNetDevice> ()->GetCellId (), "Wrong target cell");
+  // a PDCP SDU is the UDP packet with its UDP and IPv4 headers; the first
+  // one of the buffer may be the remainder of a segmented SDU
+  uint64_t sduSize = m_udpClientPktSize + 8 + 20;
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (m_bytes, m_sdus * sduSize, "More bytes than PDCP SDUs: PDCP headers counted?");
+  NS_TEST_ASSERT_MSG_GT (m_bytes, (m_sdus - 1) * sduSize, "Fewer bytes than PDCP SDUs");
+
+  Simulator::Destroy ();
+}
+
+
 /**
  * \ingroup lte-test
  * \ingroup tests
@@ -732,6 +899,7 @@ LteX2HandoverTestSuite::LteX2HandoverTestSuite ()
 
         }
     }
+  AddTestCase (new LteX2ForwardingTestCase (), TestCase::QUICK);
 }
 
 static LteX2HandoverTestSuite g_lteX2HandoverTestSuiteInstance;
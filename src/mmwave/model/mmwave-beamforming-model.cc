@@ -145,8 +145,9 @@ MmWaveDftBeamforming::SetBeamformingVectorForDevice (Ptr<NetDevice> otherDevice,
   Vector aPos = mobility->GetPosition ();
 
   NS_ASSERT_MSG (otherDevice->GetNode (), "the device " << otherDevice << " is not associated to a node");
-  NS_ASSERT_MSG (otherDevice->GetNode ()->GetObject<MobilityModel> (), "the device " << otherDevice << " has not a mobility model");
-  Vector bPos = otherDevice->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
+  Ptr<MobilityModel> otherMobility = otherDevice->GetNode ()->GetObject<MobilityModel> ();
+  NS_ASSERT_MSG (otherMobility, "the device " << otherDevice << " has not a mobility model");
+  Vector bPos = otherMobility->GetPosition ();
 
   // compute the azimuth and the elevation angles
   Angles completeAngle (bPos,aPos);
@@ -266,7 +267,7 @@ MmWaveSvdBeamforming::SetBeamformingVectorForDevice (Ptr<NetDevice> otherDevice,
 
   if (!m_useCache || toCache)
     {
-      if (channelMatrix->m_channel[0][0].size () == 0)
+      if (channelMatrix->m_channel.GetNumPages () == 0)
         {
           NS_LOG_LOGIC ("Channel has no MPCs");
 
@@ -328,9 +329,9 @@ std::pair<ThreeGppAntennaArrayModel::ComplexVector, ThreeGppAntennaArrayModel::C
 MmWaveSvdBeamforming::ComputeBeamformingVectors (Ptr<const MatrixBasedChannelModel::ChannelMatrix> params) const
 {
   //generate transmitter side spatial correlation matrix
-  uint16_t aSize = params->m_channel.size ();
-  uint16_t bSize = params->m_channel[0].size ();
-  uint16_t clusterSize = params->m_channel[0][0].size ();
+  uint16_t aSize = params->m_channel.GetNumRows ();
+  uint16_t bSize = params->m_channel.GetNumCols ();
+  uint16_t clusterSize = params->m_channel.GetNumPages ();
 
   // compute narrowband channel by summing over the cluster index
   MatrixBasedChannelModel::Complex2DVector narrowbandChannel;
@@ -346,9 +347,10 @@ MmWaveSvdBeamforming::ComputeBeamformingVectors (Ptr<const MatrixBasedChannelMod
       for (uint16_t bIndex = 0; bIndex < bSize; bIndex++)
         {
           std::complex<double> cSum (0, 0);
+          const std::complex<double> *h = params->m_channel.GetPagesBegin (aIndex, bIndex);
           for (uint16_t cIndex = 0; cIndex < clusterSize; cIndex++)
             {
-              cSum += params->m_channel[aIndex][bIndex][cIndex];
+              cSum += h[cIndex];
             }
           narrowbandChannel[aIndex][bIndex] = cSum;
         }
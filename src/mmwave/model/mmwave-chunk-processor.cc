@@ -59,7 +59,11 @@ void
 mmWaveChunkProcessor::Start ()
 {
   NS_LOG_FUNCTION (this);
-  m_sumValues = 0;
+  // reuse the accumulator of the previous reception, if any
+  if (m_sumValues != 0)
+    {
+      (*m_sumValues) = 0.0;
+    }
   m_totDuration = MicroSeconds (0);
 }
 
@@ -68,11 +72,11 @@ void
 mmWaveChunkProcessor::EvaluateChunk (const SpectrumValue& sinr, Time duration)
 {
   NS_LOG_FUNCTION (this << sinr << duration);
-  if (m_sumValues == 0)
+  if (m_sumValues == 0 || m_sumValues->GetSpectrumModel () != sinr.GetSpectrumModel ())
     {
       m_sumValues = Create<SpectrumValue> (sinr.GetSpectrumModel ());
     }
-  (*m_sumValues) += sinr * duration.GetSeconds ();
+  m_sumValues->AddScaled (sinr, duration.GetSeconds ());
   m_totDuration += duration;
 }
 
@@ -82,10 +86,12 @@ mmWaveChunkProcessor::End ()
   NS_LOG_FUNCTION (this);
   if (m_totDuration.GetSeconds () > 0)
     {
+      // average in place, the accumulator is reset by the next Start ()
+      (*m_sumValues) /= m_totDuration.GetSeconds ();
       std::vector<mmWaveChunkProcessorCallback>::iterator it;
       for (it = m_mmWaveChunkProcessorCallbacks.begin (); it != m_mmWaveChunkProcessorCallbacks.end (); it++)
         {
-          (*it)((*m_sumValues) / m_totDuration.GetSeconds ());
+          (*it)(*m_sumValues);
         }
     }
   else
@@ -611,9 +611,9 @@ MmWaveEnbMac::DoReceivePhyPdu (Ptr<Packet> p)
   uint16_t rnti = tag.GetRnti ();
   MmWaveMacPduHeader macHeader;
   p->RemoveHeader (macHeader);
-  std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator rntiIt = m_rlcAttached.find (rnti);
+  std::unordered_map <uint16_t, LcSapUserTable>::iterator rntiIt = m_rlcAttached.find (rnti);
   NS_ASSERT_MSG (rntiIt != m_rlcAttached.end (), "could not find RNTI" << rnti);
-  std::vector<MacSubheader> macSubheaders = macHeader.GetSubheaders ();
+  const std::vector<MacSubheader> &macSubheaders = macHeader.GetSubheaders ();
   uint32_t currPos = 0;
   for (unsigned ipdu = 0; ipdu < macSubheaders.size (); ipdu++)
     {
@@ -621,8 +621,8 @@ MmWaveEnbMac::DoReceivePhyPdu (Ptr<Packet> p)
         {
           continue;
         }
-      std::map<uint8_t, LteMacSapUser*>::iterator lcidIt = rntiIt->second.find (macSubheaders[ipdu].m_lcid);
-      NS_ASSERT_MSG (lcidIt != rntiIt->second.end (), "could not find LCID" << macSubheaders[ipdu].m_lcid);
+      LteMacSapUser* lcSapUser = GetLcSapUser (rntiIt->second, macSubheaders[ipdu].m_lcid);
+      NS_ASSERT_MSG (lcSapUser != 0, "could not find LCID" << macSubheaders[ipdu].m_lcid);
       Ptr<Packet> rlcPdu;
       if ((p->GetSize () - currPos) < (uint32_t)macSubheaders[ipdu].m_size)
         {
@@ -640,7 +640,7 @@ MmWaveEnbMac::DoReceivePhyPdu (Ptr<Packet> p)
           rxPduParams.p = rlcPdu;
           rxPduParams.rnti = rnti;
           rxPduParams.lcid = macSubheaders[ipdu].m_lcid;
-          (*lcidIt).second->ReceivePdu (rxPduParams);
+          lcSapUser->ReceivePdu (rxPduParams);
         }
       else
         {
@@ -651,7 +651,7 @@ MmWaveEnbMac::DoReceivePhyPdu (Ptr<Packet> p)
           rxPduParams.p = rlcPdu;
           rxPduParams.rnti = rnti;
           rxPduParams.lcid = macSubheaders[ipdu].m_lcid;
-          (*lcidIt).second->ReceivePdu (rxPduParams);
+          lcSapUser->ReceivePdu (rxPduParams);
         }
       NS_LOG_INFO ("MmWave Enb Mac Rx Packet, Rnti:" << rnti << " lcid:" << (uint32_t)macSubheaders[ipdu].m_lcid << " size:" << macSubheaders[ipdu].m_size);
     }
@@ -804,7 +804,7 @@ MmWaveEnbMac::DoDlHarqFeedback (DlHarqInfo params)
 {
   NS_LOG_FUNCTION (this);
   // Update HARQ buffer
-  std::map <uint16_t, MmWaveDlHarqProcessesBuffer_t>::iterator it =  m_miDlHarqProcessesPackets.find (params.m_rnti);
+  std::unordered_map <uint16_t, MmWaveDlHarqProcessesBuffer_t>::iterator it =  m_miDlHarqProcessesPackets.find (params.m_rnti);
   NS_ASSERT (it != m_miDlHarqProcessesPackets.end ());
 
   if (params.m_harqStatus == DlHarqInfo::ACK)
@@ -868,15 +868,21 @@ MmWaveEnbMac::DoTransmitPdu (LteMacSapProvider::TransmitPduParameters params)
   // TB UID passed back along with RLC data as HARQ process ID
   uint32_t tbMapKey = ((params.rnti & 0xFFFF) << 8) | (params.harqProcessId & 0xFF);
   NS_LOG_LOGIC ("Tx RLC PDU for rnti " << params.rnti << " lcid " << (uint32_t) params.lcid);
-  std::map<uint32_t, struct MacPduInfo>::iterator it = m_macPduMap.find (tbMapKey);
+  std::unordered_map<uint32_t, struct MacPduInfo>::iterator it = m_macPduMap.find (tbMapKey);
   if (it == m_macPduMap.end ())
     {
       NS_FATAL_ERROR ("No MAC PDU storage element found for this TB UID/RNTI");
     }
   else
     {
-      if (it->second.m_pdu == 0)
+      if (it->second.m_pdu->GetSize () == 0)
         {
+          // the first RLC PDU becomes the MAC PDU, rather than being
+          // copied into the empty one: only the MAC PDU tag is kept
+          MmWaveMacPduTag pduTag;
+          it->second.m_pdu->PeekPacketTag (pduTag);
+          params.pdu->RemoveAllPacketTags ();
+          params.pdu->AddPacketTag (pduTag);
           it->second.m_pdu = params.pdu;
         }
       else
@@ -907,10 +913,10 @@ MmWaveEnbMac::DoSchedConfigIndication (MmWaveMacSchedSapUser::SchedConfigIndPara
           // here log all the packets sent in downlink
           m_macDlTxSizeRetx (rnti, m_cellId, ttiAllocInfo.m_dci.m_tbSize, ttiAllocInfo.m_dci.m_rv);
 
-          std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator rntiIt = m_rlcAttached.find (rnti);
+          std::unordered_map <uint16_t, LcSapUserTable>::iterator rntiIt = m_rlcAttached.find (rnti);
           if (rntiIt == m_rlcAttached.end ())
             {
-              NS_FATAL_ERROR ("Scheduled UE " << rntiIt->first << " not attached");
+              NS_FATAL_ERROR ("Scheduled UE " << rnti << " not attached");
             }
           else
             {
@@ -929,7 +935,7 @@ MmWaveEnbMac::DoSchedConfigIndication (MmWaveMacSchedSapUser::SchedConfigIndPara
                   MacPduInfo macPduInfo (pduSfn, ttiAllocInfo.m_dci.m_tbSize, rlcPduInfo.size (), dciElem);
                   // insert into MAC PDU map
                   uint32_t tbMapKey = ((rnti & 0xFFFF) << 8) | (tbUid & 0xFF);
-                  std::pair <std::map<uint32_t, struct MacPduInfo>::iterator, bool> mapRet =
+                  std::pair <std::unordered_map<uint32_t, struct MacPduInfo>::iterator, bool> mapRet =
                     m_macPduMap.insert (std::pair<uint32_t, struct MacPduInfo> (tbMapKey, macPduInfo));
                   if (!mapRet.second)
                     {
@@ -937,19 +943,19 @@ MmWaveEnbMac::DoSchedConfigIndication (MmWaveMacSchedSapUser::SchedConfigIndPara
                     }
 
                   // new data -> force emptying correspondent harq pkt buffer
-                  std::map <uint16_t, MmWaveDlHarqProcessesBuffer_t>::iterator harqIt = m_miDlHarqProcessesPackets.find (rnti);
+                  std::unordered_map <uint16_t, MmWaveDlHarqProcessesBuffer_t>::iterator harqIt = m_miDlHarqProcessesPackets.find (rnti);
                   NS_ASSERT (harqIt != m_miDlHarqProcessesPackets.end ());
                   Ptr<PacketBurst> pb = CreateObject <PacketBurst> ();
                   harqIt->second.at (tbUid).m_pktBurst = pb;
                   harqIt->second.at (tbUid).m_lcidList.clear ();
 
-                  std::map<uint32_t, struct MacPduInfo>::iterator pduMapIt = mapRet.first;
+                  std::unordered_map<uint32_t, struct MacPduInfo>::iterator pduMapIt = mapRet.first;
                   pduMapIt->second.m_numRlcPdu = 0;
                   for (unsigned int ipdu = 0; ipdu < rlcPduInfo.size (); ipdu++)
                     {
                       NS_ASSERT_MSG (rntiIt != m_rlcAttached.end (), "could not find RNTI" << rnti);
-                      std::map<uint8_t, LteMacSapUser*>::iterator lcidIt = rntiIt->second.find (rlcPduInfo[ipdu].m_lcid);
-                      NS_ASSERT_MSG (lcidIt != rntiIt->second.end (), "could not find LCID" << rlcPduInfo[ipdu].m_lcid);
+                      LteMacSapUser* lcSapUser = GetLcSapUser (rntiIt->second, rlcPduInfo[ipdu].m_lcid);
+                      NS_ASSERT_MSG (lcSapUser != 0, "could not find LCID" << rlcPduInfo[ipdu].m_lcid);
                       NS_LOG_DEBUG ("Notifying RLC of TX opportunity for TB " << (unsigned int)tbUid << " PDU num " << ipdu << " size " << (unsigned int) rlcPduInfo[ipdu].m_size);
                       MacSubheader subheader (rlcPduInfo[ipdu].m_lcid, rlcPduInfo[ipdu].m_size);
 
@@ -959,7 +965,7 @@ MmWaveEnbMac::DoSchedConfigIndication (MmWaveMacSchedSapUser::SchedConfigIndPara
                       txOpParams.componentCarrierId = m_componentCarrierId;
                       txOpParams.rnti = rnti;
                       txOpParams.lcid = rlcPduInfo[ipdu].m_lcid;
-                      (*lcidIt).second->NotifyTxOpportunity (txOpParams);
+                      lcSapUser->NotifyTxOpportunity (txOpParams);
                       harqIt->second.at (tbUid).m_lcidList.push_back (rlcPduInfo[ipdu].m_lcid);
                     }
 
@@ -994,7 +1000,7 @@ MmWaveEnbMac::DoSchedConfigIndication (MmWaveMacSchedSapUser::SchedConfigIndPara
                   if (dciElem.m_tbSize > 0)
                     {
                       // HARQ retransmission -> retrieve TB from HARQ buffer
-                      std::map <uint16_t, MmWaveDlHarqProcessesBuffer_t>::iterator it = m_miDlHarqProcessesPackets.find (rnti);
+                      std::unordered_map <uint16_t, MmWaveDlHarqProcessesBuffer_t>::iterator it = m_miDlHarqProcessesPackets.find (rnti);
                       NS_ASSERT (it != m_miDlHarqProcessesPackets.end ());
                       Ptr<PacketBurst> pb = it->second.at (tbUid).m_pktBurst;
                       for (std::list<Ptr<Packet> >::const_iterator j = pb->Begin (); j != pb->End (); ++j)
@@ -1055,10 +1061,8 @@ void
 MmWaveEnbMac::DoAddUe (uint16_t rnti)
 {
   NS_LOG_FUNCTION (this << " DoAddUe rnti=" << rnti);
-  std::map<uint8_t, LteMacSapUser*> empty;
-  std::pair <std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator, bool>
-  ret = m_rlcAttached.insert (std::pair <uint16_t,  std::map<uint8_t, LteMacSapUser*> >
-                                (rnti, empty));
+  std::pair <std::unordered_map <uint16_t, LcSapUserTable>::iterator, bool>
+  ret = m_rlcAttached.insert (std::pair <uint16_t, LcSapUserTable> (rnti, LcSapUserTable ()));
   NS_ASSERT_MSG (ret.second, "element already present, RNTI already existed");
   //m_associatedUe.push_back (rnti);
 
@@ -1109,12 +1113,15 @@ MmWaveEnbMac::DoAddLc (LteEnbCmacSapProvider::LcInfo lcinfo, LteMacSapUser* msu)
 
   LteFlowId_t flow (lcinfo.rnti, lcinfo.lcId);
 
-  std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator rntiIt = m_rlcAttached.find (lcinfo.rnti);
+  std::unordered_map <uint16_t, LcSapUserTable>::iterator rntiIt = m_rlcAttached.find (lcinfo.rnti);
   NS_ASSERT_MSG (rntiIt != m_rlcAttached.end (), "RNTI not found");
-  std::map<uint8_t, LteMacSapUser*>::iterator lcidIt = rntiIt->second.find (lcinfo.lcId);
-  if (lcidIt == rntiIt->second.end ())
+  if (GetLcSapUser (rntiIt->second, lcinfo.lcId) == 0)
     {
-      rntiIt->second.insert (std::pair<uint8_t, LteMacSapUser*> (lcinfo.lcId, msu));
+      if (rntiIt->second.size () <= lcinfo.lcId)
+        {
+          rntiIt->second.resize (lcinfo.lcId + 1, 0);
+        }
+      rntiIt->second[lcinfo.lcId] = msu;
     }
   else
     {
@@ -1158,8 +1165,11 @@ MmWaveEnbMac::DoReleaseLc (uint16_t rnti, uint8_t lcid)
 {
   //Find user based on rnti and then erase lcid stored against the same
   NS_LOG_INFO ("ReleaseLc");
-  std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator rntiIt = m_rlcAttached.find (rnti);
-  rntiIt->second.erase (lcid);
+  std::unordered_map <uint16_t, LcSapUserTable>::iterator rntiIt = m_rlcAttached.find (rnti);
+  if (lcid < rntiIt->second.size ())
+    {
+      rntiIt->second[lcid] = 0;
+    }
 
   struct MmWaveMacCschedSapProvider::CschedLcReleaseReqParameters params;
   params.m_rnti = rnti;
@@ -1167,6 +1177,12 @@ MmWaveEnbMac::DoReleaseLc (uint16_t rnti, uint8_t lcid)
   m_macCschedSapProvider->CschedLcReleaseReq (params);
 }
 
+LteMacSapUser*
+MmWaveEnbMac::GetLcSapUser (const LcSapUserTable &table, uint8_t lcid)
+{
+  return lcid < table.size () ? table[lcid] : 0;
+}
+
 void
 MmWaveEnbMac::UeUpdateConfigurationReq (LteEnbCmacSapProvider::UeConfig params)
 {
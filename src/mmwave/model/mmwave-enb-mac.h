@@ -42,6 +42,7 @@
 #include <ns3/lte-mac-sap.h>
 #include "mmwave-phy-mac-common.h"
 #include <ns3/lte-ccm-mac-sap.h>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -201,6 +202,16 @@ private:
   void DoDlHarqFeedback (DlHarqInfo params);
   void DoUlHarqFeedback (UlHarqInfo params);
 
+  /// MAC SAP users of the logical channels of a UE, indexed by LCID
+  typedef std::vector<LteMacSapUser*> LcSapUserTable;
+
+  /**
+   * \param table the logical channels of a UE
+   * \param lcid the LCID
+   * \return the MAC SAP user of the logical channel, or 0 if it is not attached
+   */
+  static LteMacSapUser* GetLcSapUser (const LcSapUserTable &table, uint8_t lcid);
+
  /**
   * Triggers the callback for the SchedulingTraceEnb Trace Source
   * 
@@ -228,7 +239,7 @@ private:
   uint8_t m_slotNum;
 
   uint8_t m_tbUid;
-  std::map<uint32_t, struct MacPduInfo> m_macPduMap;
+  std::unordered_map<uint32_t, struct MacPduInfo> m_macPduMap;
 
   std::list <uint16_t> m_associatedUe;
 
@@ -248,11 +259,11 @@ private:
 
   std::map<uint8_t, uint32_t> m_receivedRachPreambleCount;
 
-  std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> > m_rlcAttached;
+  std::unordered_map <uint16_t, LcSapUserTable> m_rlcAttached;
 
   std::vector <DlHarqInfo> m_dlHarqInfoReceived;       // DL HARQ feedback received
   std::vector <UlHarqInfo> m_ulHarqInfoReceived;       // UL HARQ feedback received
-  std::map <uint16_t, MmWaveDlHarqProcessesBuffer_t> m_miDlHarqProcessesPackets;       // Packet under trasmission of the DL HARQ process
+  std::unordered_map <uint16_t, MmWaveDlHarqProcessesBuffer_t> m_miDlHarqProcessesPackets;       // Packet under trasmission of the DL HARQ process
 
   /**
   * info associated with a preamble allocated for non-contention based RA
@@ -576,6 +576,7 @@ MmWaveEnbPhy::UpdateUeSinrEstimate ()
 
   Ptr<SpectrumValue> noisePsd = MmWaveSpectrumValueHelper::CreateNoisePowerSpectralDensity (m_phyMacConfig, m_noiseFigure);
   Ptr<SpectrumValue> totalReceivedPsd = Create <SpectrumValue> (SpectrumValue (noisePsd->GetSpectrumModel ()));
+  Ptr<MobilityModel> enbMob = m_netDevice->GetNode ()->GetObject<MobilityModel> ();
 
   for (std::map<uint64_t, Ptr<NetDevice> >::iterator ue = m_ueAttachedImsiMap.begin (); ue != m_ueAttachedImsiMap.end (); ++ue)
     {
@@ -610,10 +611,9 @@ MmWaveEnbPhy::UpdateUeSinrEstimate ()
       // create tx psd
       Ptr<SpectrumValue> txPsd =                                                        // it is the eNB that dictates the conf, m_listOfSubchannels contains all the subch
         MmWaveSpectrumValueHelper::CreateTxPowerSpectralDensity (m_phyMacConfig, ueTxPower, m_listOfSubchannels);
-      NS_LOG_LOGIC ("TxPsd " << *txPsd);
+      NS_LOG_RATE_LIMITED (LOG_LOGIC, 10, "TxPsd " << *txPsd);
 
-      // get this node and remote node mobility
-      Ptr<MobilityModel> enbMob = m_netDevice->GetNode ()->GetObject<MobilityModel> ();
+      // get the remote node mobility
       NS_LOG_LOGIC ("eNB mobility " << enbMob->GetPosition ());
       Ptr<MobilityModel> ueMob = ue->second->GetNode ()->GetObject<MobilityModel> ();
       NS_LOG_DEBUG ("UE mobility " << ueMob->GetPosition ());
@@ -656,7 +656,7 @@ MmWaveEnbPhy::UpdateUeSinrEstimate ()
       *(rxPsd) *= pathGainLinear;
 
       rxPsd = m_spectrumPropagationLossModel->CalcRxPowerSpectralDensity (rxPsd, ueMob, enbMob);
-      NS_LOG_LOGIC ("RxPsd " << *rxPsd);
+      NS_LOG_RATE_LIMITED (LOG_LOGIC, 10, "RxPsd " << *rxPsd);
 
       m_rxPsdMap[ue->first] = rxPsd;
       *totalReceivedPsd += *rxPsd;
@@ -1002,7 +1002,7 @@ MmWaveEnbPhy::StartTti (void)
       // Trace current DL transmission info
       TraceDlPhyTransmission (currTti.m_dci, PhyTransmissionTraceParams::CTRL);
 
-      SendCtrlChannels (ctrlMsgs, ttiPeriod - NanoSeconds (1.0));       // -1 ns ensures control ends before data period
+      SendCtrlChannels (std::move (ctrlMsgs), ttiPeriod - NanoSeconds (1.0));       // -1 ns ensures control ends before data period
     }
   else if (m_ttiIndex == m_currSlotNumTti - 1)      // Last TTI of this slot: reserved UL control
     {
@@ -1185,8 +1185,7 @@ MmWaveEnbPhy::SendDataChannels (Ptr<PacketBurst> pb, Time slotPrd, TtiAllocInfo&
     }
 
 
-  std::list<Ptr<MmWaveControlMessage> > ctrlMsgs;
-  m_downlinkSpectrumPhy->StartTxDataFrames (pb, ctrlMsgs, slotPrd, slotInfo.m_ttiIdx);
+  m_downlinkSpectrumPhy->StartTxDataFrames (pb, std::list<Ptr<MmWaveControlMessage> > (), slotPrd, slotInfo.m_ttiIdx);
 }
 
 void
@@ -1194,7 +1193,7 @@ MmWaveEnbPhy::SendCtrlChannels (std::list<Ptr<MmWaveControlMessage> > ctrlMsgs,
 {
   /* Send Ctrl messages*/
   NS_LOG_FUNCTION (this << "Send Ctrl");
-  m_downlinkSpectrumPhy->StartTxDlControlFrames (ctrlMsgs, slotPrd);
+  m_downlinkSpectrumPhy->StartTxDlControlFrames (std::move (ctrlMsgs), slotPrd);
 }
 
 bool
@@ -1253,8 +1252,11 @@ MmWaveEnbPhy::GenerateDataCqiReport (const SpectrumValue& sinr)
   // here we use the start symbol index of the slot in place of the slot index because the absolute UL slot index is
   // not known to the scheduler when m_allocationMap gets populated
   ulcqi.m_sfnSf = SfnSf (m_frameNum, m_sfNum, m_slotNum, m_currSymStart); // TODO: .m_slotNum expected to carry m_currSymStart
-  SpectrumValue newSinr = sinr;
-  m_ulSinrTrace (0, newSinr, newSinr);
+  if (!m_ulSinrTrace.IsEmpty ())
+    {
+      SpectrumValue newSinr = sinr;
+      m_ulSinrTrace (0, newSinr, newSinr);
+    }
   m_phySapUser->UlCqiReport (ulcqi);
 }
 
@@ -1310,6 +1312,10 @@ MmWaveEnbPhy::GetAbsoluteSubframeNo ()
 void
 MmWaveEnbPhy::TraceDlPhyTransmission (DciInfoElementTdma dciInfo, uint8_t tddType)
 {
+  if (m_dlPhyTrace.IsEmpty ())
+    {
+      return;
+    }
   PhyTransmissionTraceParams dlPhyTraceInfo;   //!< Holds the current DL transmission info
   dlPhyTraceInfo.m_frameNum = m_frameNum;
   dlPhyTraceInfo.m_sfNum = m_sfNum;
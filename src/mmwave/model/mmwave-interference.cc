@@ -43,9 +43,7 @@ namespace mmwave {
 
 
 mmWaveInterference::mmWaveInterference ()
-  : m_receiving (false),
-    m_lastSignalId (0),
-    m_lastSignalIdBeforeReset (0)
+  : m_receiving (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -64,6 +62,8 @@ mmWaveInterference::DoDispose ()
   m_rxSignal = 0;
   m_allSignals = 0;
   m_noise = 0;
+  m_sinr = 0;
+  m_signalEnds.clear ();
   Object::DoDispose ();
 }
 
@@ -138,17 +138,17 @@ mmWaveInterference::AddSignal (Ptr<const SpectrumValue> spd, const Time duration
 {
   NS_LOG_FUNCTION (this << *spd << duration);
   DoAddSignal (spd);
-  uint32_t signalId = ++m_lastSignalId;
-  if (signalId == m_lastSignalIdBeforeReset)
+
+  // signals of the same slot end together, so group them and subtract
+  // all of them with a single event
+  Time endTime = Now () + duration;
+  std::map<Time, std::vector<Ptr<const SpectrumValue> > >::iterator it = m_signalEnds.find (endTime);
+  if (it == m_signalEnds.end ())
     {
-      // This happens when m_lastSignalId eventually wraps around. Given that so
-      // many signals have elapsed since the last reset, we hope that by now there is
-      // no stale pending signal (i.e., a signal that was scheduled
-      // for subtraction before the reset). So we just move the
-      // boundary further.
-      m_lastSignalIdBeforeReset += 0x10000000;
+      it = m_signalEnds.insert (std::make_pair (endTime, std::vector<Ptr<const SpectrumValue> > ())).first;
+      Simulator::Schedule (duration, &mmWaveInterference::DoSubtractSignals, this);
     }
-  Simulator::Schedule (duration, &mmWaveInterference::DoSubtractSignal, this, spd, signalId);
+  it->second.push_back (spd);
 }
 
 
@@ -161,18 +161,19 @@ mmWaveInterference::DoAddSignal (Ptr<const SpectrumValue> spd)
 }
 
 void
-mmWaveInterference::DoSubtractSignal  (Ptr<const SpectrumValue> spd, uint32_t signalId)
+mmWaveInterference::DoSubtractSignals ()
 {
-  NS_LOG_FUNCTION (this << *spd);
+  NS_LOG_FUNCTION (this);
   ConditionallyEvaluateChunk ();
-  int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
-  if (deltaSignalId > 0)
+  // the signals scheduled for subtraction before the last reset were
+  // dropped together with m_allSignals, so anything left here is current
+  while (!m_signalEnds.empty () && m_signalEnds.begin ()->first <= Now ())
     {
-      (*m_allSignals) -= (*spd);
-    }
-  else
-    {
-      NS_LOG_INFO ("ignoring signal scheduled for subtraction before last reset");
+      for (const Ptr<const SpectrumValue> &spd : m_signalEnds.begin ()->second)
+        {
+          (*m_allSignals) -= (*spd);
+        }
+      m_signalEnds.erase (m_signalEnds.begin ());
     }
 }
 
@@ -189,16 +190,29 @@ mmWaveInterference::ConditionallyEvaluateChunk ()
   if (m_receiving && (Now () > m_lastChangeTime))
     {
       NS_LOG_LOGIC (this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
-      SpectrumValue interf =  (*m_allSignals) - (*m_rxSignal) + (*m_noise);
-      SpectrumValue sinr = (*m_rxSignal) / interf;
       Time duration = Now () - m_lastChangeTime;
       for (std::list<Ptr<mmWaveChunkProcessor> >::const_iterator it = m_PowerChunkProcessorList.begin (); it != m_PowerChunkProcessorList.end (); ++it)
         {
           (*it)->EvaluateChunk (*m_rxSignal, duration);
         }
-      for (std::list<Ptr<mmWaveChunkProcessor> >::const_iterator it = m_sinrChunkProcessorList.begin (); it != m_sinrChunkProcessorList.end (); ++it)
+      if (!m_sinrChunkProcessorList.empty ())
         {
-          (*it)->EvaluateChunk (sinr, duration);
+          // sinr = rxSignal / (allSignals - rxSignal + noise), computed in a
+          // single pass into the preallocated buffer
+          Values::const_iterator itRx = m_rxSignal->ConstValuesBegin ();
+          Values::const_iterator itAll = m_allSignals->ConstValuesBegin ();
+          Values::const_iterator itNoise = m_noise->ConstValuesBegin ();
+          for (Values::iterator itSinr = m_sinr->ValuesBegin (); itSinr != m_sinr->ValuesEnd (); ++itSinr)
+            {
+              *itSinr = *itRx / (*itAll - *itRx + *itNoise);
+              ++itRx;
+              ++itAll;
+              ++itNoise;
+            }
+          for (std::list<Ptr<mmWaveChunkProcessor> >::const_iterator it = m_sinrChunkProcessorList.begin (); it != m_sinrChunkProcessorList.end (); ++it)
+            {
+              (*it)->EvaluateChunk (*m_sinr, duration);
+            }
         }
       m_lastChangeTime = Now ();
     }
@@ -211,12 +225,14 @@ mmWaveInterference::SetNoisePowerSpectralDensity (Ptr<const SpectrumValue> noise
   ConditionallyEvaluateChunk ();
   m_noise = noisePsd;
   m_allSignals = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
+  m_sinr = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
   if (m_receiving == true)
     {
       // abort rx
       m_receiving = false;
     }
-  m_lastSignalIdBeforeReset = m_lastSignalId;
+  // the pending subtractions refer to the signals just dropped
+  m_signalEnds.clear ();
 }
 
 void
@@ -36,6 +36,8 @@
 #include <ns3/spectrum-value.h>
 #include <string.h>
 #include <ns3/mmwave-chunk-processor.h>
+#include <map>
+#include <vector>
 
 
 namespace ns3 {
@@ -59,7 +61,7 @@ public:
 private:
   void ConditionallyEvaluateChunk ();
   void DoAddSignal (Ptr<const SpectrumValue> spd);
-  void DoSubtractSignal  (Ptr<const SpectrumValue> spd, uint32_t signalId);
+  void DoSubtractSignals ();
   std::list<Ptr<mmWaveChunkProcessor> > m_PowerChunkProcessorList;
   std::list<Ptr<mmWaveChunkProcessor> > m_sinrChunkProcessorList;
 
@@ -69,11 +71,15 @@ private:
   Ptr<SpectrumValue> m_rxSignal;
   Ptr<SpectrumValue> m_allSignals;
   Ptr<const SpectrumValue> m_noise;
+  Ptr<SpectrumValue> m_sinr; ///< buffer reused for the SINR of each chunk
 
   Time m_lastChangeTime;
 
-  uint32_t m_lastSignalId;
-  uint32_t m_lastSignalIdBeforeReset;
+  /**
+   * The signals currently summed in m_allSignals, grouped by the time at
+   * which they end. A single subtraction event is scheduled per end time.
+   */
+  std::map<Time, std::vector<Ptr<const SpectrumValue> > > m_signalEnds;
 };
 
 } // namespace mmwave
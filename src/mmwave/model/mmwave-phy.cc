@@ -216,16 +216,14 @@ MmWavePhy::SetMacPdu (Ptr<Packet> p)
   if (p->PeekPacketTag (tag))
     {
       NS_ASSERT ((tag.GetSfn ().m_sfNum >= 0) && (tag.GetSfn ().m_sfNum < m_phyMacConfig->GetSubframesPerFrame ()));
-      std::map<uint64_t, Ptr<PacketBurst> >::iterator it = m_packetBurstMap.find (tag.GetSfn ().Encode ());
-      if (it == m_packetBurstMap.end ())
-        {
-          it = m_packetBurstMap.insert (std::pair<uint64_t, Ptr<PacketBurst> > (tag.GetSfn ().Encode (), CreateObject<PacketBurst> ())).first;
-        }
-      else
+      std::pair<std::unordered_map<uint64_t, Ptr<PacketBurst> >::iterator, bool> ret =
+        m_packetBurstMap.insert (std::make_pair (tag.GetSfn ().Encode (), Ptr<PacketBurst> ()));
+      if (!ret.second)
         {
           NS_FATAL_ERROR ("Packet burst map entry already exists");
         }
-      it->second->AddPacket (p);
+      ret.first->second = CreateObject<PacketBurst> ();
+      ret.first->second->AddPacket (p);
     }
   else
     {
@@ -237,7 +235,7 @@ Ptr<PacketBurst>
 MmWavePhy::GetPacketBurst (SfnSf sfn)
 {
   Ptr<PacketBurst> pburst;
-  std::map<uint64_t, Ptr<PacketBurst> >::iterator it = m_packetBurstMap.find (sfn.Encode ());
+  std::unordered_map<uint64_t, Ptr<PacketBurst> >::iterator it = m_packetBurstMap.find (sfn.Encode ());
   if (it == m_packetBurstMap.end ())
     {
       NS_LOG_ERROR ("GetPacketBurst(): Packet burst not found for frame " << (unsigned)sfn.m_frameNum << " subframe "
@@ -263,7 +261,7 @@ MmWavePhy::SetControlMessage (Ptr<MmWaveControlMessage> m)
     }
   else
     {
-      m_controlMessageQueue.at (m_controlMessageQueue.size () - 1).push_back (m);
+      m_controlMessageQueue.back ().push_back (m);
     }
 }
 
@@ -271,28 +269,18 @@ std::list<Ptr<MmWaveControlMessage> >
 MmWavePhy::GetControlMessages (void)
 {
   NS_LOG_FUNCTION (this);
+  std::list<Ptr<MmWaveControlMessage> > ret;
   if (m_controlMessageQueue.empty ())
     {
-      std::list<Ptr<MmWaveControlMessage> > emptylist;
-      return (emptylist);
+      return ret;
     }
 
-  if (m_controlMessageQueue.at (0).size () > 0)
-    {
-      std::list<Ptr<MmWaveControlMessage> > ret = m_controlMessageQueue.front ();
-      m_controlMessageQueue.erase (m_controlMessageQueue.begin ());
-      std::list<Ptr<MmWaveControlMessage> > newlist;
-      m_controlMessageQueue.push_back (newlist);
-      return (ret);
-    }
-  else
-    {
-      m_controlMessageQueue.erase (m_controlMessageQueue.begin ());
-      std::list<Ptr<MmWaveControlMessage> > newlist;
-      m_controlMessageQueue.push_back (newlist);
-      std::list<Ptr<MmWaveControlMessage> > emptylist;
-      return (emptylist);
-    }
+  // move the messages of the current slot out of the queue, without
+  // copying them, and append an empty list for the last slot
+  ret.swap (m_controlMessageQueue.front ());
+  m_controlMessageQueue.pop_front ();
+  m_controlMessageQueue.push_back (std::list<Ptr<MmWaveControlMessage> > ());
+  return ret;
 }
 
 void
@@ -53,6 +53,8 @@
 #include "mmwave-phy-sap.h"
 #include <string>
 #include <map>
+#include <deque>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -169,8 +171,8 @@ protected:
 
   Ptr<MmWavePhyMacCommon> m_phyMacConfig;
 
-  std::map<uint64_t, Ptr<PacketBurst> > m_packetBurstMap;
-  std::vector< std::list<Ptr<MmWaveControlMessage> > > m_controlMessageQueue;
+  std::unordered_map<uint64_t, Ptr<PacketBurst> > m_packetBurstMap; //!< MAC PDUs to be sent, indexed by encoded SfnSf
+  std::deque< std::list<Ptr<MmWaveControlMessage> > > m_controlMessageQueue; //!< control messages to be sent, one list per slot
 
   std::vector <SlotAllocInfo> m_slotAllocInfo;  //!< Maps slot number to its allocation info
 
@@ -184,8 +186,6 @@ protected:
   Time m_slotPeriod;            //!< Slot period time duration
   Time m_lastSlotStart;         //!< Time at which the current slot started
 
-  std::map <uint32_t,SlotAllocInfo> m_slotAllocInfoMap;
-
   MmWavePhySapProvider* m_phySapProvider;
 
   uint32_t m_raPreambleId;
@@ -450,7 +450,9 @@ MmWaveSpectrumPhy::StartRxData (Ptr<MmwaveSpectrumSignalParametersDataFrame> par
               m_rxPacketBurstList.push_back (params->packetBurst);
             }
 
-          m_rxControlMessageList.insert (m_rxControlMessageList.end (), params->ctrlMsgList.begin (), params->ctrlMsgList.end ());
+          // each receiver gets its own copy of the signal parameters from
+          // the channel, hence the messages can be moved instead of copied
+          m_rxControlMessageList.splice (m_rxControlMessageList.end (), params->ctrlMsgList);
 
           NS_LOG_LOGIC (this << " numSimultaneousRxEvents = " << m_rxPacketBurstList.size ());
         }
@@ -491,7 +493,7 @@ MmWaveSpectrumPhy::StartRxCtrl (Ptr<MmWaveSpectrumSignalParametersDlCtrlFrame> d
                 }
               NS_ASSERT ((m_firstRxStart == Simulator::Now ()) && (m_firstRxDuration == dlCtrlRxParams->duration));
 
-              m_rxControlMessageList.insert (m_rxControlMessageList.end (), dlCtrlRxParams->ctrlMsgList.begin (), dlCtrlRxParams->ctrlMsgList.end ());
+              m_rxControlMessageList.splice (m_rxControlMessageList.end (), dlCtrlRxParams->ctrlMsgList);
             }
           else
             {
@@ -517,7 +519,7 @@ MmWaveSpectrumPhy::StartRxCtrl (Ptr<MmWaveSpectrumSignalParametersDlCtrlFrame> d
               NS_LOG_LOGIC (this << " scheduling EndRx with delay " << dlCtrlRxParams->duration);
 
               // store the DCIs
-              m_rxControlMessageList = dlCtrlRxParams->ctrlMsgList;
+              m_rxControlMessageList.swap (dlCtrlRxParams->ctrlMsgList);
               m_endRxDlCtrlEvent = Simulator::Schedule (dlCtrlRxParams->duration, &MmWaveSpectrumPhy::EndRxCtrl, this);
               ChangeState (RX_CTRL);
             }
@@ -606,10 +608,11 @@ MmWaveSpectrumPhy::EndRxData ()
 
   // fire the traces and send the ACKs/NACKs
   std::map <uint16_t, DlHarqInfo> harqDlInfoMap;
-  for (auto packetBurst : m_rxPacketBurstList)
+  for (const auto &packetBurst : m_rxPacketBurstList)
     {
-      for (auto packet : packetBurst->GetPackets ())
+      for (auto itPkt = packetBurst->Begin (); itPkt != packetBurst->End (); ++itPkt)
         {
+          const Ptr<Packet> &packet = *itPkt;
           if (packet->GetSize () == 0)
             {
               continue;
@@ -841,7 +844,7 @@ MmWaveSpectrumPhy::StartTxDataFrames (Ptr<PacketBurst> pb, std::list<Ptr<MmWaveC
           txParams->psd = m_txPsd;
           txParams->packetBurst = pb;
           txParams->cellId = m_cellId;
-          txParams->ctrlMsgList = ctrlMsgList;
+          txParams->ctrlMsgList = std::move (ctrlMsgList);
           txParams->slotInd = slotInd;
           txParams->txAntenna = GetRxAntenna (); // TODO do we need to know the antenna?
           NS_LOG_DEBUG(Simulator::Now().GetSeconds() << " StartTxDataFrames " << txParams << " cellId " << m_cellId
@@ -888,7 +891,7 @@ MmWaveSpectrumPhy::StartTxDlControlFrames (std::list<Ptr<MmWaveControlMessage> >
           txParams->psd = m_txPsd;
           txParams->cellId = m_cellId;
           txParams->pss = true;
-          txParams->ctrlMsgList = ctrlMsgList;
+          txParams->ctrlMsgList = std::move (ctrlMsgList);
           txParams->txAntenna = GetRxAntenna (); // TODO do we need to know the antenna?
 
           m_channel->StartTx (txParams);
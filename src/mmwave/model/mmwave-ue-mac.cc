@@ -310,7 +310,7 @@ void
 MmWaveUeMac::DoTransmitPdu (LteMacSapProvider::TransmitPduParameters params)
 {
   // TB UID passed back along with RLC data as HARQ process ID
-  std::map<uint32_t, struct MacPduInfo>::iterator it = m_macPduMap.find (params.harqProcessId);
+  std::unordered_map<uint32_t, struct MacPduInfo>::iterator it = m_macPduMap.find (params.harqProcessId);
   if (it == m_macPduMap.end ())
     {
       NS_FATAL_ERROR ("No MAC PDU storage element found for this TB UID/RNTI");
@@ -323,8 +323,14 @@ MmWaveUeMac::DoTransmitPdu (LteMacSapProvider::TransmitPduParameters params)
         {
           return;
         }
-      if (it->second.m_pdu == 0)
+      if (it->second.m_pdu->GetSize () == 0)
         {
+          // the first RLC PDU becomes the MAC PDU, rather than being
+          // copied into the empty one: only the MAC PDU tag is kept
+          MmWaveMacPduTag pduTag;
+          it->second.m_pdu->PeekPacketTag (pduTag);
+          params.pdu->RemoveAllPacketTags ();
+          params.pdu->AddPacketTag (pduTag);
           it->second.m_pdu = params.pdu;
         }
       else
@@ -630,7 +636,7 @@ MmWaveUeMac::RecvRaResponse (BuildRarListElement_s raResponse)
   //   }
 }
 
-std::map<uint32_t, struct MacPduInfo>::iterator MmWaveUeMac::AddToMacPduMap (DciInfoElementTdma dci, unsigned activeLcs)
+std::unordered_map<uint32_t, struct MacPduInfo>::iterator MmWaveUeMac::AddToMacPduMap (DciInfoElementTdma dci, unsigned activeLcs)
 {
   uint8_t slotNum = (m_slotNum + m_phyMacConfig->GetUlSchedDelay ()) % m_phyMacConfig->GetSlotsPerSubframe ();
   uint8_t deltaSubframe = (m_slotNum + m_phyMacConfig->GetUlSchedDelay ()) / m_phyMacConfig->GetSlotsPerSubframe ();
@@ -641,7 +647,7 @@ std::map<uint32_t, struct MacPduInfo>::iterator MmWaveUeMac::AddToMacPduMap (Dci
              && (deltaSubframe >= 0) && (slotNum >= 0) && (sfNum >= 0) && (frameNum >= m_frameNum));
 
   MacPduInfo macPduInfo (SfnSf (frameNum, sfNum, slotNum, dci.m_symStart), dci.m_tbSize, activeLcs);
-  std::map<uint32_t, struct MacPduInfo>::iterator it = m_macPduMap.find (dci.m_harqProcess);
+  std::unordered_map<uint32_t, struct MacPduInfo>::iterator it = m_macPduMap.find (dci.m_harqProcess);
   if (it != m_macPduMap.end ())
     {
       m_macPduMap.erase (it);
@@ -723,7 +729,7 @@ MmWaveUeMac::DoReceiveControlMessage  (Ptr<MmWaveControlMessage> msg)
                     return;
                   }
 
-                std::map<uint32_t, struct MacPduInfo>::iterator macPduIt = AddToMacPduMap (dciInfoElem, activeLcs);
+                std::unordered_map<uint32_t, struct MacPduInfo>::iterator macPduIt = AddToMacPduMap (dciInfoElem, activeLcs);
                 std::map <uint8_t, LcInfo>::iterator lcIt;
                 uint32_t bytesPerActiveLc = dciInfoElem.m_tbSize / activeLcs;
                 bool statusPduPriority = false;
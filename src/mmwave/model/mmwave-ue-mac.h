@@ -41,6 +41,7 @@
 #include <ns3/lte-ue-cmac-sap.h>
 #include <ns3/lte-mac-sap.h>
 #include <ns3/lte-radio-bearer-tag.h>
+#include <unordered_map>
 
 
 namespace ns3 {
@@ -115,7 +116,7 @@ private:
   void SendReportBufferStatus (void);
   void RefreshHarqProcessesPacketBuffer (void);
 
-  std::map<uint32_t, struct MacPduInfo>::iterator AddToMacPduMap (DciInfoElementTdma dci, unsigned activeLcs);
+  std::unordered_map<uint32_t, struct MacPduInfo>::iterator AddToMacPduMap (DciInfoElementTdma dci, unsigned activeLcs);
 
   /// component carrier Id --> used to address sap
   uint8_t m_componentCarrierId;
@@ -136,7 +137,7 @@ private:
   uint8_t m_slotNum;
 
   //uint8_t	m_tbUid;
-  std::map<uint32_t, struct MacPduInfo> m_macPduMap;
+  std::unordered_map<uint32_t, struct MacPduInfo> m_macPduMap;
 
   std::map <uint8_t, LteMacSapProvider::ReportBufferStatusParameters> m_ulBsrReceived;       // BSR received from RLC (the last one)
   Time m_bsrPeriodicity;
@@ -575,7 +575,7 @@ MmWaveUePhy::StartTti ()
       // Trace current UL transmission info
       TraceUlPhyTransmission (currTti.m_dci, PhyTransmissionTraceParams::CTRL);
 
-      SendCtrlChannels (ctrlMsg, currTtiDuration - NanoSeconds (1.0));
+      SendCtrlChannels (std::move (ctrlMsg), currTtiDuration - NanoSeconds (1.0));
 
     }
   else if (currTti.m_dci.m_format == DciInfoElementTdma::DL_dci)  // Scheduled DL data Tti
@@ -727,19 +727,19 @@ MmWaveUePhy::SendDataChannels (Ptr<PacketBurst> pb, std::list<Ptr<MmWaveControlM
   if (pb->GetNPackets () > 0)
     {
       LteRadioBearerTag tag;
-      if (!pb->GetPackets ().front ()->PeekPacketTag (tag))
+      if (!(*pb->Begin ())->PeekPacketTag (tag))
         {
           NS_FATAL_ERROR ("No radio bearer tag");
         }
       // call only if the packet burst is > 0
-      m_downlinkSpectrumPhy->StartTxDataFrames (pb, ctrlMsg, duration, slotInd);
+      m_downlinkSpectrumPhy->StartTxDataFrames (pb, std::move (ctrlMsg), duration, slotInd);
     }
 }
 
 void
 MmWaveUePhy::SendCtrlChannels (std::list<Ptr<MmWaveControlMessage> > ctrlMsg, Time prd)
 {
-  m_downlinkSpectrumPhy->StartTxDlControlFrames (ctrlMsg,prd);
+  m_downlinkSpectrumPhy->StartTxDlControlFrames (std::move (ctrlMsg), prd);
 }
 
 
@@ -972,6 +972,10 @@ MmWaveUePhy::DoSetSrsConfigurationIndex (uint16_t srcCi)
 void
 MmWaveUePhy::TraceUlPhyTransmission (DciInfoElementTdma dciInfo, uint8_t tddType)
 {
+  if (m_ulPhyTrace.IsEmpty ())
+    {
+      return;
+    }
   PhyTransmissionTraceParams ulPhyTraceInfo;   //!< Holds the current UL transmission info
   ulPhyTraceInfo.m_frameNum = m_frameNum;
   ulPhyTraceInfo.m_sfNum = m_sfNum;
@@ -51,6 +51,8 @@ NS_LOG_COMPONENT_DEFINE ("Buffer");
 
 
 uint32_t Buffer::g_recommendedStart = 0;
+uint64_t Buffer::g_dataAllocations = 0;
+uint64_t Buffer::g_dataReuses = 0;
 #ifdef BUFFER_FREE_LIST
 /* The following macros are pretty evil but they are needed to allow us to
  * keep track of 3 possible states for the g_freeList variable:
@@ -75,7 +77,20 @@ uint32_t Buffer::g_recommendedStart = 0;
 #define IS_INITIALIZED(x) (!IS_UNINITIALIZED (x) && !IS_DESTROYED (x))
 #define DESTROYED ((Buffer::FreeList*)MAGIC_DESTROYED)
 #define UNINITIALIZED ((Buffer::FreeList*)0)
-uint32_t Buffer::g_maxSize = 0;
+/* The buffers are recycled in one free list per size class: the powers
+ * of two and the half steps between them (64, 96, 128, 192, ... bytes),
+ * from 2^FREE_LIST_MIN_SHIFT bytes (the first class) to 1 MiB. Larger
+ * buffers are not recycled. The half steps bound the memory wasted by
+ * rounding a buffer up to its class to a third of the class size (e.g.,
+ * a 1500-byte packet takes 1536 bytes, not 2048).
+ * A single free list, where only the buffers as large as the largest
+ * one ever seen could be recycled, stops working as soon as the packet
+ * sizes vary, e.g., with large MAC PDUs mixed with TCP acks.
+ */
+#define FREE_LIST_MIN_SHIFT 6
+#define FREE_LIST_CLASSES 29
+#define FREE_LIST_CLASS_BYTES (1U << 20)
+#define FREE_LIST_CLASS_MAX_SIZE 1000U
 Buffer::FreeList *Buffer::g_freeList = 0;
 struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
 
@@ -84,34 +99,67 @@ Buffer::LocalStaticDestructor::~LocalStaticDestructor(void)
   NS_LOG_FUNCTION (this);
   if (IS_INITIALIZED (g_freeList))
     {
-      for (Buffer::FreeList::iterator i = g_freeList->begin ();
-           i != g_freeList->end (); i++)
+      for (uint32_t sizeClass = 0; sizeClass < FREE_LIST_CLASSES; sizeClass++)
         {
-          Buffer::Deallocate (*i);
+          for (Buffer::FreeList::iterator i = g_freeList[sizeClass].begin ();
+               i != g_freeList[sizeClass].end (); i++)
+            {
+              Buffer::Deallocate (*i);
+            }
         }
-      delete g_freeList;
+      delete [] g_freeList;
       g_freeList = DESTROYED;
     }
 }
 
+uint32_t
+Buffer::GetClassSize (uint32_t sizeClass)
+{
+  uint32_t power = 1U << (sizeClass / 2 + FREE_LIST_MIN_SHIFT);
+  return (sizeClass % 2) ? power + power / 2 : power;
+}
+
+uint32_t
+Buffer::GetSizeClass (uint32_t size)
+{
+  if (size <= (1U << FREE_LIST_MIN_SHIFT))
+    {
+      return 0;
+    }
+  if (size > GetClassSize (FREE_LIST_CLASSES - 1))
+    {
+      return FREE_LIST_CLASSES;
+    }
+  /* find the power of two such that 2^shift < size <= 2^(shift+1), then
+   * pick the half step above it or the next power */
+  uint32_t shift = FREE_LIST_MIN_SHIFT;
+  while ((2U << shift) < size)
+    {
+      shift++;
+    }
+  return 2 * (shift - FREE_LIST_MIN_SHIFT) + (size <= (3U << (shift - 1)) ? 1 : 2);
+}
+
 void
 Buffer::Recycle (struct Buffer::Data *data)
 {
   NS_LOG_FUNCTION (data);
   NS_ASSERT (data->m_count == 0);
   NS_ASSERT (!IS_UNINITIALIZED (g_freeList));
-  g_maxSize = std::max (g_maxSize, data->m_size);
-  /* feed into free list */
-  if (data->m_size < g_maxSize ||
-      IS_DESTROYED (g_freeList) ||
-      g_freeList->size () > 1000)
+  uint32_t sizeClass = GetSizeClass (data->m_size);
+  /* feed into the free list of its size, keeping about
+   * FREE_LIST_CLASS_BYTES of memory in each list */
+  if (IS_DESTROYED (g_freeList) ||
+      sizeClass == FREE_LIST_CLASSES ||
+      g_freeList[sizeClass].size () >= std::min (FREE_LIST_CLASS_MAX_SIZE,
+                                                 FREE_LIST_CLASS_BYTES / GetClassSize (sizeClass)))
     {
       Buffer::Deallocate (data);
     }
   else
     {
       NS_ASSERT (IS_INITIALIZED (g_freeList));
-      g_freeList->push_back (data);
+      g_freeList[sizeClass].push_back (data);
     }
 }
 
@@ -119,24 +167,23 @@ Buffer::Data *
 Buffer::Create (uint32_t dataSize)
 {
   NS_LOG_FUNCTION (dataSize);
-  /* try to find a buffer correctly sized. */
   if (IS_UNINITIALIZED (g_freeList))
     {
-      g_freeList = new Buffer::FreeList ();
+      g_freeList = new Buffer::FreeList [FREE_LIST_CLASSES];
     }
-  else if (IS_INITIALIZED (g_freeList))
+  uint32_t sizeClass = GetSizeClass (dataSize);
+  if (sizeClass < FREE_LIST_CLASSES)
     {
-      while (!g_freeList->empty ()) 
+      /* all the buffers of a free list are large enough */
+      if (IS_INITIALIZED (g_freeList) && !g_freeList[sizeClass].empty ())
         {
-          struct Buffer::Data *data = g_freeList->back ();
-          g_freeList->pop_back ();
-          if (data->m_size >= dataSize) 
-            {
-              data->m_count = 1;
-              return data;
-            }
-          Buffer::Deallocate (data);
+          struct Buffer::Data *data = g_freeList[sizeClass].back ();
+          g_freeList[sizeClass].pop_back ();
+          data->m_count = 1;
+          g_dataReuses++;
+          return data;
         }
+      dataSize = GetClassSize (sizeClass);
     }
   struct Buffer::Data *data = Buffer::Allocate (dataSize);
   NS_ASSERT (data->m_count == 1);
@@ -170,6 +217,7 @@ Buffer::Allocate (uint32_t reqSize)
   NS_ASSERT (reqSize >= 1);
   uint32_t size = reqSize - 1 + sizeof (struct Buffer::Data);
   uint8_t *b = new uint8_t [size];
+  g_dataAllocations++;
   struct Buffer::Data *data = reinterpret_cast<struct Buffer::Data*>(b);
   data->m_size = reqSize;
   data->m_count = 1;
@@ -185,6 +233,18 @@ Buffer::Deallocate (struct Buffer::Data *data)
   delete [] buf;
 }
 
+uint64_t
+Buffer::GetDataAllocations (void)
+{
+  return g_dataAllocations;
+}
+
+uint64_t
+Buffer::GetDataReuses (void)
+{
+  return g_dataReuses;
+}
+
 Buffer::Buffer ()
 {
   NS_LOG_FUNCTION (this);
@@ -244,7 +304,8 @@ void
 Buffer::Initialize (uint32_t zeroSize)
 {
   NS_LOG_FUNCTION (this << zeroSize);
-  m_data = Buffer::Create (0);
+  // leave room for the headers usually added to new buffers
+  m_data = Buffer::Create (g_recommendedStart);
   m_start = std::min (m_data->m_size, g_recommendedStart);
   m_maxZeroAreaStart = m_start;
   m_zeroAreaStart = m_start;
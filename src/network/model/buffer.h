@@ -27,6 +27,8 @@
 
 #define BUFFER_FREE_LIST 1
 
+class BufferFreeListTest;
+
 namespace ns3 {
 
 /**
@@ -642,7 +644,24 @@ private:
    */
   Buffer (uint32_t dataSize, bool initialize);
   ~Buffer ();
+
+  /**
+   * \returns the number of buffer data storages allocated from the heap
+   * since the start of the program
+   */
+  static uint64_t GetDataAllocations (void);
+  /**
+   * \returns the number of buffer data storages reused from the free
+   * lists since the start of the program
+   */
+  static uint64_t GetDataReuses (void);
 private:
+  /**
+   * \brief BufferFreeListTest test case.
+   * \relates BufferFreeListTest
+   */
+  friend class ::BufferFreeListTest;
+
   /**
    * This data structure is variable-sized through its last member whose size
    * is determined at allocation time and stored in the m_size field.
@@ -790,6 +809,9 @@ private:
    */
   uint32_t m_end;
 
+  static uint64_t g_dataAllocations; //!< Number of buffer data allocated from the heap
+  static uint64_t g_dataReuses; //!< Number of buffer data reused from the free lists
+
 #ifdef BUFFER_FREE_LIST
   /// Container for buffer data
   typedef std::vector<struct Buffer::Data*> FreeList;
@@ -798,8 +820,25 @@ private:
   {
     ~LocalStaticDestructor ();
   };
-  static uint32_t g_maxSize; //!< Max observed data size
-  static FreeList *g_freeList; //!< Buffer data container
+  /**
+   * \brief Get the free list of a buffer data size
+   *
+   * The free lists hold buffer data storages of the powers of two
+   * and of the half steps between them, one list per size.
+   *
+   * \param size the buffer data size
+   * \returns the index of the free list of the smallest size not
+   * smaller than size, FREE_LIST_CLASSES if there is none
+   */
+  static uint32_t GetSizeClass (uint32_t size);
+  /**
+   * \brief Get the buffer data size of a free list
+   *
+   * \param sizeClass the index of the free list
+   * \returns the size of the buffer data storages of the free list
+   */
+  static uint32_t GetClassSize (uint32_t sizeClass);
+  static FreeList *g_freeList; //!< Buffer data containers, one per size class
   static struct LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
 #endif
 };
@@ -31,6 +31,8 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("ByteTagList");
 
+static uint64_t g_dataAllocations = 0; //!< Number of ByteTagListData allocated from the heap
+
 /**
  * \ingroup packet
  *
@@ -137,6 +139,11 @@ ByteTagList::Iterator::GetOffsetStart (void) const
   return m_offsetStart;
 }
 
+uint64_t
+ByteTagList::GetDataAllocations (void)
+{
+  return g_dataAllocations;
+}
 
 ByteTagList::ByteTagList ()
   : m_minStart (INT32_MAX),
@@ -360,6 +367,7 @@ ByteTagList::Allocate (uint32_t size)
       delete [] buffer;
     }
   uint8_t *buffer = new uint8_t [std::max (size, g_maxSize) + sizeof (struct ByteTagListData) - 4];
+  g_dataAllocations++;
   struct ByteTagListData *data = (struct ByteTagListData *)buffer;
   data->count = 1;
   data->size = size;
@@ -399,6 +407,7 @@ ByteTagList::Allocate (uint32_t size)
 {
   NS_LOG_FUNCTION (this << size);
   uint8_t *buffer = new uint8_t [size + sizeof (struct ByteTagListData) - 4];
+  g_dataAllocations++;
   struct ByteTagListData *data = (struct ByteTagListData *)buffer;
   data->count = 1;
   data->size = size;
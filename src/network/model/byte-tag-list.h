@@ -255,6 +255,12 @@ private:
    */
   uint32_t Deserialize (const uint32_t* buffer, uint32_t size);
 
+  /**
+   * \returns the number of tag list storages allocated from the heap
+   * since the start of the program
+   */
+  static uint64_t GetDataAllocations (void);
+
 private:
   /**
    * \brief Returns an iterator pointing to the very first tag in this list.
@@ -37,6 +37,9 @@ bool PacketMetadata::m_metadataSkipped = false;
 uint32_t PacketMetadata::m_maxSize = 0;
 uint16_t PacketMetadata::m_chunkUid = 0;
 PacketMetadata::DataFreeList PacketMetadata::m_freeList;
+bool PacketMetadata::m_freeListDestroyed = false;
+uint64_t PacketMetadata::m_dataAllocations = 0;
+uint64_t PacketMetadata::m_dataReuses = 0;
 
 PacketMetadata::DataFreeList::~DataFreeList ()
 {
@@ -46,6 +49,7 @@ PacketMetadata::DataFreeList::~DataFreeList ()
       PacketMetadata::Deallocate (*i);
     }
   PacketMetadata::m_enable = false;
+  PacketMetadata::m_freeListDestroyed = true;
 }
 
 void 
@@ -70,6 +74,18 @@ PacketMetadata::EnableChecking (void)
   m_enableChecking = true;
 }
 
+uint64_t
+PacketMetadata::GetDataAllocations (void)
+{
+  return m_dataAllocations;
+}
+
+uint64_t
+PacketMetadata::GetDataReuses (void)
+{
+  return m_dataReuses;
+}
+
 void
 PacketMetadata::ReserveCopy (uint32_t size)
 {
@@ -583,6 +599,7 @@ PacketMetadata::Create (uint32_t size)
         {
           NS_LOG_LOGIC ("create found size="<<data->m_size);
           data->m_count = 1;
+          m_dataReuses++;
           return data;
         }
       NS_LOG_LOGIC ("create dealloc size="<<data->m_size);
@@ -596,14 +613,16 @@ void
 PacketMetadata::Recycle (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
-  if (!m_enable)
+  // even when the metadata are disabled each packet holds a storage,
+  // which is recycled as long as the free list exists
+  if (m_freeListDestroyed)
     {
       PacketMetadata::Deallocate (data);
       return;
     } 
   NS_LOG_LOGIC ("recycle size="<<data->m_size<<", list="<<m_freeList.size ());
   NS_ASSERT (data->m_count == 0);
-  if (m_freeList.size () > 1000 ||
+  if (m_freeList.size () >= 1000 ||
       data->m_size < m_maxSize) 
     {
       PacketMetadata::Deallocate (data);
@@ -625,6 +644,7 @@ PacketMetadata::Allocate (uint32_t n)
     }
   size += n - PACKET_METADATA_DATA_M_DATA_SIZE;
   uint8_t *buf = new uint8_t [size];
+  m_dataAllocations++;
   struct PacketMetadata::Data *data = (struct PacketMetadata::Data *)buf;
   data->m_size = n;
   data->m_count = 1;
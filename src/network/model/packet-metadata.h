@@ -161,6 +161,17 @@ private:
    */
   static void EnableChecking (void);
 
+  /**
+   * \returns the number of metadata storages allocated from the heap
+   * since the start of the program
+   */
+  static uint64_t GetDataAllocations (void);
+  /**
+   * \returns the number of metadata storages reused from the free list
+   * since the start of the program
+   */
+  static uint64_t GetDataReuses (void);
+
   /**
    * \brief Constructor
    * \param uid packet uid
@@ -662,6 +673,9 @@ public:
   static void Deallocate (struct PacketMetadata::Data *data);
 
   static DataFreeList m_freeList; //!< the metadata data storage
+  static bool m_freeListDestroyed; //!< the static m_freeList has been destroyed
+  static uint64_t m_dataAllocations; //!< Number of metadata storages allocated from the heap
+  static uint64_t m_dataReuses; //!< Number of metadata storages reused from the free list
   static bool m_enable; //!< Enable the packet metadata
   static bool m_enableChecking; //!< Enable the packet metadata checking
 
@@ -34,6 +34,14 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PacketTagList");
 
+static uint64_t g_tagDataAllocations = 0; //!< Number of TagData allocated from the heap
+
+uint64_t
+PacketTagList::GetTagDataAllocations (void)
+{
+  return g_tagDataAllocations;
+}
+
 PacketTagList::TagData *
 PacketTagList::CreateTagData (size_t dataSize)
 {
@@ -44,6 +52,7 @@ PacketTagList::CreateTagData (size_t dataSize)
                  << std::numeric_limits<decltype(TagData::size)>::max () );
 
   void * p = std::malloc (sizeof (TagData) + dataSize - 1);
+  g_tagDataAllocations++;
   // The matching frees are in RemoveAll and RemoveWriter
 
   TagData * tag = new (p) TagData;
@@ -242,6 +242,12 @@ public:
    */
   uint32_t Deserialize (const uint32_t* buffer, uint32_t size);
 
+  /**
+   * \returns the number of TagData allocated from the heap since the
+   * start of the program
+   */
+  static uint64_t GetTagDataAllocations (void);
+
 private:
   /**
    * Allocate and construct a TagData struct, sizing the data area
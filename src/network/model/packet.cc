@@ -582,6 +582,19 @@ Packet::EnableChecking (void)
   PacketMetadata::EnableChecking ();
 }
 
+Packet::AllocationStats
+Packet::GetAllocationStats (void)
+{
+  AllocationStats stats;
+  stats.bufferAllocations = Buffer::GetDataAllocations ();
+  stats.bufferReuses = Buffer::GetDataReuses ();
+  stats.metadataAllocations = PacketMetadata::GetDataAllocations ();
+  stats.metadataReuses = PacketMetadata::GetDataReuses ();
+  stats.byteTagAllocations = ByteTagList::GetDataAllocations ();
+  stats.packetTagAllocations = PacketTagList::GetTagDataAllocations ();
+  return stats;
+}
+
 uint32_t Packet::GetSerializedSize (void) const
 {
   uint32_t size = 0;
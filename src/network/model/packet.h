@@ -531,6 +531,28 @@ public:
    */
   static void EnableChecking (void);
 
+  /**
+   * \brief Counters of the memory allocations done for the packets
+   *
+   * The counters are global: the allocations done by a layer can be
+   * measured as the difference between two snapshots.
+   */
+  struct AllocationStats
+  {
+    uint64_t bufferAllocations;    //!< Buffer storages allocated from the heap
+    uint64_t bufferReuses;         //!< Buffer storages reused from the free lists
+    uint64_t metadataAllocations;  //!< PacketMetadata storages allocated from the heap
+    uint64_t metadataReuses;       //!< PacketMetadata storages reused from the free list
+    uint64_t byteTagAllocations;   //!< ByteTagList storages allocated from the heap
+    uint64_t packetTagAllocations; //!< PacketTagList nodes allocated from the heap
+  };
+
+  /**
+   * \returns the counters of the memory allocations done for the
+   * packets since the start of the program
+   */
+  static AllocationStats GetAllocationStats (void);
+
   /**
    * \brief Returns number of bytes required for packet
    * serialization.
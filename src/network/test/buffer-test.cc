@@ -389,6 +389,74 @@ BufferTest::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (val1, val2, "Bad ReadNtohU16()");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Buffer data free list unit tests.
+ */
+class BufferFreeListTest : public TestCase {
+public:
+  virtual void DoRun (void);
+  BufferFreeListTest ();
+};
+
+
+BufferFreeListTest::BufferFreeListTest ()
+  : TestCase ("Buffer free lists") {
+}
+
+void
+BufferFreeListTest::DoRun (void)
+{
+  // the classes are the powers of two from 64 bytes and the half steps
+  // between them, up to 1 MiB
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (1), 0, "Wrong class of 1 byte");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (64), 0, "Wrong class of 64 bytes");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (65), 1, "Wrong class of 65 bytes");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (96), 1, "Wrong class of 96 bytes");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (97), 2, "Wrong class of 97 bytes");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (1500), 9, "Wrong class of 1500 bytes");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetClassSize (9), 1536, "Wrong size of class 9");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (1U << 20), 28, "Wrong class of 1 MiB");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetClassSize (28), 1U << 20, "Wrong size of the last class");
+  // no class: FREE_LIST_CLASSES
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass ((1U << 20) + 1), 29, "Class given to more than 1 MiB");
+  for (uint32_t sizeClass = 1; sizeClass < 29; sizeClass++)
+    {
+      uint32_t classSize = Buffer::GetClassSize (sizeClass);
+      NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (classSize), sizeClass, "Class " << sizeClass << " does not hold its size");
+      NS_TEST_ASSERT_MSG_EQ (Buffer::GetSizeClass (classSize + 1), sizeClass + 1, "Class " << sizeClass << " holds more than its size");
+    }
+
+  // a freed storage serves the next request of its class, without a new allocation
+  Buffer::Data *data = Buffer::Create (100);
+  NS_TEST_ASSERT_MSG_EQ (data->m_size, 128, "Storage not rounded up to its class size");
+  data->m_count = 0;
+  Buffer::Recycle (data);
+  uint64_t allocations = Buffer::GetDataAllocations ();
+  uint64_t reuses = Buffer::GetDataReuses ();
+  Buffer::Data *reused = Buffer::Create (120);
+  NS_TEST_ASSERT_MSG_EQ (reused, data, "Freed storage not reused");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetDataReuses (), reuses + 1, "Reuse not counted");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetDataAllocations (), allocations, "Storage allocated despite the reuse");
+  reused->m_count = 0;
+  Buffer::Recycle (reused);
+
+  // larger than every class: allocated with its exact size, never kept
+  Buffer::Data *large = Buffer::Create ((1U << 20) + 1);
+  NS_TEST_ASSERT_MSG_EQ (large->m_size, (1U << 20) + 1, "Storage larger than every class rounded up");
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetDataAllocations (), allocations + 1, "Large storage not allocated");
+  large->m_count = 0;
+  Buffer::Recycle (large);
+  reuses = Buffer::GetDataReuses ();
+  large = Buffer::Create ((1U << 20) + 1);
+  NS_TEST_ASSERT_MSG_EQ (Buffer::GetDataReuses (), reuses, "Storage larger than every class reused");
+  large->m_count = 0;
+  Buffer::Recycle (large);
+}
+
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -405,6 +473,7 @@ BufferTestSuite::BufferTestSuite ()
   : TestSuite ("buffer", UNIT)
 {
   AddTestCase (new BufferTest, TestCase::QUICK);
+  AddTestCase (new BufferFreeListTest, TestCase::QUICK);
 }
 
 static BufferTestSuite g_bufferTestSuite; //!< Static variable for test initialization
@@ -54,13 +54,114 @@ public:
   typedef std::vector<ThreeGppAntennaArrayModel::ComplexVector> Complex2DVector; //!< type definition for complex matrices
   typedef std::vector<Complex2DVector> Complex3DVector; //!< type definition for complex 3D matrices
 
+  /**
+   * Complex 3D matrix H[u][s][n] stored in a single contiguous buffer.
+   *
+   * The elements are stored with the last index (the cluster, for the
+   * channel matrix) varying fastest, hence the coefficients of all the
+   * clusters between a pair of antenna elements are adjacent in memory
+   * and can be accessed through GetPagesBegin ().
+   */
+  class Complex3DMatrix
+  {
+  public:
+    /**
+     * Create an empty matrix
+     */
+    Complex3DMatrix ()
+      : m_numRows (0),
+        m_numCols (0),
+        m_numPages (0)
+    {
+    }
+
+    /**
+     * Create a matrix with all the elements set to zero
+     * \param numRows size of the first dimension (u)
+     * \param numCols size of the second dimension (s)
+     * \param numPages size of the third dimension (n)
+     */
+    Complex3DMatrix (size_t numRows, size_t numCols, size_t numPages)
+      : m_numRows (numRows),
+        m_numCols (numCols),
+        m_numPages (numPages),
+        m_values (numRows * numCols * numPages)
+    {
+    }
+
+    /**
+     * \return the size of the first dimension (u)
+     */
+    size_t GetNumRows () const
+    {
+      return m_numRows;
+    }
+
+    /**
+     * \return the size of the second dimension (s)
+     */
+    size_t GetNumCols () const
+    {
+      return m_numCols;
+    }
+
+    /**
+     * \return the size of the third dimension (n)
+     */
+    size_t GetNumPages () const
+    {
+      return m_numPages;
+    }
+
+    /**
+     * \param u the first index
+     * \param s the second index
+     * \param n the third index
+     * \return a reference to the element H[u][s][n]
+     */
+    std::complex<double>& operator() (size_t u, size_t s, size_t n)
+    {
+      NS_ASSERT (u < m_numRows && s < m_numCols && n < m_numPages);
+      return m_values[(u * m_numCols + s) * m_numPages + n];
+    }
+
+    /**
+     * \param u the first index
+     * \param s the second index
+     * \param n the third index
+     * \return a const reference to the element H[u][s][n]
+     */
+    const std::complex<double>& operator() (size_t u, size_t s, size_t n) const
+    {
+      NS_ASSERT (u < m_numRows && s < m_numCols && n < m_numPages);
+      return m_values[(u * m_numCols + s) * m_numPages + n];
+    }
+
+    /**
+     * \param u the first index
+     * \param s the second index
+     * \return a pointer to the GetNumPages () contiguous elements H[u][s][.]
+     */
+    const std::complex<double>* GetPagesBegin (size_t u, size_t s) const
+    {
+      NS_ASSERT (u < m_numRows && s < m_numCols);
+      return m_values.data () + (u * m_numCols + s) * m_numPages;
+    }
+
+  private:
+    size_t m_numRows; //!< size of the first dimension
+    size_t m_numCols; //!< size of the second dimension
+    size_t m_numPages; //!< size of the third dimension
+    std::vector<std::complex<double> > m_values; //!< the elements, the third index varies fastest
+  };
+
 
   /**
    * Data structure that stores a channel realization
    */
   struct ChannelMatrix : public SimpleRefCount<ChannelMatrix>
   {
-    Complex3DVector    m_channel; //!< channel matrix H[u][s][n].
+    Complex3DMatrix    m_channel; //!< channel matrix H[u][s][n].
     DoubleVector       m_delay; //!< cluster delay in nanoseconds.
     Double2DVector     m_angle; //!< cluster angle angle[direction][n], where direction = 0(AOA), 1(ZOA), 2(AOD), 3(ZOD) in degree.
     Time               m_generatedTime; //!< generation time
@@ -269,7 +269,7 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
 
           if ((*rxPhyIterator) != txParams->txPhy)
             {
-              NS_LOG_LOGIC ("copying signal parameters " << txParams);
+              NS_LOG_RATE_LIMITED (LOG_LOGIC, 100, "copying signal parameters " << txParams);
               Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
               rxParams->psd = Copy<SpectrumValue> (convertedTxPowerSpectrum);
               Time delay = MicroSeconds (0);
@@ -286,7 +286,7 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                     {
                       Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
                       txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
-                      NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
+                      NS_LOG_RATE_LIMITED (LOG_LOGIC, 100, "txAntennaGain = " << txAntennaGain << " dB");
                       pathLossDb -= txAntennaGain;
                     }
                   Ptr<AntennaModel> rxAntenna = (*rxPhyIterator)->GetRxAntenna ();
@@ -294,16 +294,16 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                     {
                       Angles rxAngles (txMobility->GetPosition (), receiverMobility->GetPosition ());
                       rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
-                      NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
+                      NS_LOG_RATE_LIMITED (LOG_LOGIC, 100, "rxAntennaGain = " << rxAntennaGain << " dB");
                       pathLossDb -= rxAntennaGain;
                     }
                   if (m_propagationLoss)
                     {
                       propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, receiverMobility);
-                      NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
+                      NS_LOG_RATE_LIMITED (LOG_LOGIC, 100, "propagationGainDb = " << propagationGainDb << " dB");
                       pathLossDb -= propagationGainDb;
                     }                    
-                  NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+                  NS_LOG_RATE_LIMITED (LOG_LOGIC, 100, "total pathLoss = " << pathLossDb << " dB");
                   // Gain trace
                   m_gainTrace (txMobility, receiverMobility, txAntennaGain, rxAntennaGain, propagationGainDb, pathLossDb);
                   // Pathloss trace
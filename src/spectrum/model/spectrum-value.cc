@@ -674,6 +674,24 @@ SpectrumValue::operator= (double rhs)
   return *this;
 }
 
+SpectrumValue&
+SpectrumValue::AddScaled (const SpectrumValue& x, double a)
+{
+  Values::iterator it1 = m_values.begin ();
+  Values::const_iterator it2 = x.m_values.begin ();
+
+  NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
+  NS_ASSERT (m_values.size () == x.m_values.size ());
+
+  while (it1 != m_values.end ())
+    {
+      *it1 += *it2 * a;
+      ++it1;
+      ++it2;
+    }
+  return *this;
+}
+
 
 
 SpectrumValue
@@ -420,6 +420,19 @@ public:
    */
   SpectrumValue& operator= (double rhs);
 
+  /**
+   * Add the Right Hand Side, scaled by a flat factor, to *this,
+   * component by component. This is equivalent to
+   * \code *this += x * a \endcode but does not allocate a temporary
+   * SpectrumValue.
+   *
+   * @param x the SpectrumValue to be scaled and added
+   * @param a the scaling factor
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& AddScaled (const SpectrumValue& x, double a);
+
 
 
   /**
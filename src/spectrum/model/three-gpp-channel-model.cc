@@ -976,8 +976,10 @@ ThreeGppChannelModel::GetChannel (Ptr<const MobilityModel> aMob,
   NS_LOG_FUNCTION (this);
 
   // Compute the channel key. The key is reciprocal, i.e., key (a, b) = key (b, a)
-  uint32_t x1 = std::min (aMob->GetObject<Node> ()->GetId (), bMob->GetObject<Node> ()->GetId ());
-  uint32_t x2 = std::max (aMob->GetObject<Node> ()->GetId (), bMob->GetObject<Node> ()->GetId ());
+  uint32_t aId = aMob->GetObject<Node> ()->GetId ();
+  uint32_t bId = bMob->GetObject<Node> ()->GetId ();
+  uint32_t x1 = std::min (aId, bId);
+  uint32_t x2 = std::max (aId, bId);
   uint32_t channelId = GetKey (x1, x2);
 
   // retrieve the channel condition
@@ -1008,17 +1010,19 @@ ThreeGppChannelModel::GetChannel (Ptr<const MobilityModel> aMob,
   if (notFound || update)
     {
       // channel matrix not found or has to be updated, generate a new one
-      Angles txAngle (bMob->GetPosition (), aMob->GetPosition ());
-      Angles rxAngle (aMob->GetPosition (), bMob->GetPosition ());
+      Vector aPos = aMob->GetPosition ();
+      Vector bPos = bMob->GetPosition ();
+      Angles txAngle (bPos, aPos);
+      Angles rxAngle (aPos, bPos);
 
-      double x = aMob->GetPosition ().x - bMob->GetPosition ().x;
-      double y = aMob->GetPosition ().y - bMob->GetPosition ().y;
+      double x = aPos.x - bPos.x;
+      double y = aPos.y - bPos.y;
       double distance2D = sqrt (x * x + y * y);
 
       // NOTE we assume hUT = min (height(a), height(b)) and
       // hBS = max (height (a), height (b))
-      double hUt = std::min (aMob->GetPosition ().z, bMob->GetPosition ().z);
-      double hBs = std::max (aMob->GetPosition ().z, bMob->GetPosition ().z);
+      double hUt = std::min (aPos.z, bPos.z);
+      double hBs = std::max (aPos.z, bPos.z);
 
       // TODO this is not currently used, it is needed for the computation of the
       // additional blockage in case of spatial consistent update
@@ -1027,7 +1031,7 @@ ThreeGppChannelModel::GetChannel (Ptr<const MobilityModel> aMob,
       Vector locUt = Vector (0.0, 0.0, 0.0);
 
       channelMatrix = GetNewChannel (locUt, condition, aAntenna, bAntenna, rxAngle, txAngle, distance2D, hBs, hUt);
-      channelMatrix->m_nodeIds = std::make_pair (aMob->GetObject<Node> ()->GetId (), bMob->GetObject<Node> ()->GetId ());
+      channelMatrix->m_nodeIds = std::make_pair (aId, bId);
 
       // store or replace the channel matrix in the channel map
       m_channelMap[channelId] = channelMatrix;
@@ -1077,10 +1081,8 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
       paramNum = 6;
     }
   //Generate paramNum independent LSPs.
-  for (uint8_t iter = 0; iter < paramNum; iter++)
-    {
-      LSPsIndep.push_back (m_normalRv->GetValue ());
-    }
+  LSPsIndep.resize (paramNum);
+  m_normalRv->GetValues (LSPsIndep.data (), paramNum);
   for (uint8_t row = 0; row < paramNum; row++)
     {
       double temp = 0;
@@ -1123,16 +1125,17 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   NS_LOG_INFO ("K-factor=" << K_factor << ",DS=" << DS << ", ASD=" << ASD << ", ASA=" << ASA << ", ZSD=" << ZSD << ", ZSA=" << ZSA);
 
   //Step 5: Generate Delays.
-  DoubleVector clusterDelay;
+  DoubleVector clusterDelay (numOfCluster);
+  m_uniformRv->GetValues (clusterDelay.data (), numOfCluster, 0, 1);
   double minTau = 100.0;
   for (uint8_t cIndex = 0; cIndex < numOfCluster; cIndex++)
     {
-      double tau = -1 * table3gpp->m_rTau * DS * log (m_uniformRv->GetValue (0,1)); //(7.5-1)
+      double tau = -1 * table3gpp->m_rTau * DS * log (clusterDelay[cIndex]); //(7.5-1)
       if (minTau > tau)
         {
           minTau = tau;
         }
-      clusterDelay.push_back (tau);
+      clusterDelay[cIndex] = tau;
     }
 
   for (uint8_t cIndex = 0; cIndex < numOfCluster; cIndex++)
@@ -1145,14 +1148,15 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
    * we will generate cluster power first and resume to compute Los cluster delay later.*/
 
   //Step 6: Generate cluster powers.
-  DoubleVector clusterPower;
+  DoubleVector clusterPower (numOfCluster);
+  m_normalRv->GetValues (clusterPower.data (), numOfCluster);
   double powerSum = 0;
   for (uint8_t cIndex = 0; cIndex < numOfCluster; cIndex++)
     {
       double power = exp (-1 * clusterDelay[cIndex] * (table3gpp->m_rTau - 1) / table3gpp->m_rTau / DS) *
-        pow (10,-1 * m_normalRv->GetValue () * table3gpp->m_perClusterShadowingStd / 10);                       //(7.5-5)
+        pow (10,-1 * clusterPower[cIndex] * table3gpp->m_perClusterShadowingStd / 10);                       //(7.5-5)
       powerSum += power;
-      clusterPower.push_back (power);
+      clusterPower[cIndex] = power;
     }
   double powerMax = 0;
 
@@ -1530,22 +1534,17 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   //Step 10: Draw initial phases
   Double2DVector crossPolarizationPowerRatios; // vector containing the cross polarization power ratios, as defined by 7.5-21
   Double3DVector clusterPhase; //rayAoa_radian[n][m], where n is cluster index, m is ray index
+  double uXprLinear = pow (10, table3gpp->m_uXpr / 10); // convert to linear
+  double sigXprLinear = pow (10, table3gpp->m_sigXpr / 10); // convert to linear
   for (uint8_t nInd = 0; nInd < numReducedCluster; nInd++)
     {
-      DoubleVector temp; // used to store the XPR values
-      Double2DVector temp2; // used to store the PHI values for all the possible combination of polarization
+      DoubleVector temp (raysPerCluster); // used to store the XPR values
+      Double2DVector temp2 (raysPerCluster, DoubleVector (4)); // used to store the PHI values for all the possible combination of polarization
+      m_normalRv->GetValues (temp.data (), raysPerCluster);
       for (uint8_t mInd = 0; mInd < raysPerCluster; mInd++)
         {
-          double uXprLinear = pow (10, table3gpp->m_uXpr / 10); // convert to linear
-          double sigXprLinear = pow (10, table3gpp->m_sigXpr / 10); // convert to linear
-
-          temp.push_back (std::pow (10, (m_normalRv->GetValue () * sigXprLinear + uXprLinear) / 10));
-          DoubleVector temp3; // used to store the PHI valuse
-          for (uint8_t pInd = 0; pInd < 4; pInd++)
-            {
-              temp3.push_back (m_uniformRv->GetValue (-1 * M_PI, M_PI));
-            }
-          temp2.push_back (temp3);
+          temp[mInd] = std::pow (10, (temp[mInd] * sigXprLinear + uXprLinear) / 10);
+          m_uniformRv->GetValues (temp2[mInd].data (), 4, -1 * M_PI, M_PI);
         }
       crossPolarizationPowerRatios.push_back (temp);
       clusterPhase.push_back (temp2);
@@ -1555,7 +1554,7 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   //Step 11: Generate channel coefficients for each cluster n and each receiver
   // and transmitter element pair u,s.
 
-  Complex3DVector H_NLOS; // channel coefficients H_NLOS [u][s][n],
+  // channel coefficients H [u][s][n],
   // where u and s are receive and transmit antenna element, n is cluster index.
   uint64_t uSize = uAntenna->GetNumberOfElements ();
   uint64_t sSize = sAntenna->GetNumberOfElements ();
@@ -1582,30 +1581,111 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
 
   NS_LOG_INFO ("1st strongest cluster:" << (int)cluster1st << ", 2nd strongest cluster:" << (int)cluster2nd);
 
-  Complex3DVector H_usn;  //channel coffecient H_usn[u][s][n];
   // NOTE Since each of the strongest 2 clusters are divided into 3 sub-clusters,
-  // the total cluster will be numReducedCLuster + 4.
+  // the total cluster will be numReducedCLuster + 4 (numReducedCluster + 2
+  // if there is only one strong cluster).
+  // The two additional sub-clusters of each strong cluster are stored after
+  // the numReducedCluster clusters, in increasing order of cluster index.
+  uint8_t numSubClusters = (cluster1st == cluster2nd) ? 2 : 4;
+  Complex3DMatrix H_usn (uSize, sSize, numReducedCluster + numSubClusters);  //channel coffecient H_usn[u][s][n];
+
+  // The ray directions, the element field patterns and the initial phases
+  // do not depend on the antenna elements, hence the per-ray terms are
+  // computed once and the (u, s) loops below only combine them.
+  // The expressions are the same used per element before, so the
+  // resulting coefficients are unchanged.
+  Complex2DVector rayPolarization (numReducedCluster); // polarization term of ray m of cluster n (7.5-22)
+  Double3DVector rxRayDirection (numReducedCluster); // direction cosines of the arrival of ray m of cluster n
+  Double3DVector txRayDirection (numReducedCluster); // direction cosines of the departure of ray m of cluster n
+  for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+    {
+      rayPolarization[nIndex].resize (raysPerCluster);
+      rxRayDirection[nIndex].resize (raysPerCluster);
+      txRayDirection[nIndex].resize (raysPerCluster);
+      for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+        {
+          const DoubleVector &initialPhase = clusterPhase[nIndex][mIndex];
+          double k = crossPolarizationPowerRatios[nIndex][mIndex];
+
+          double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
+          std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
+          std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
+
+          rayPolarization[nIndex][mIndex] = exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
+            +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
+            +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
+            +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi;
+
+          rxRayDirection[nIndex][mIndex] = {sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]),
+                                            sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]),
+                                            cos (rayZoa_radian[nIndex][mIndex])};
+          txRayDirection[nIndex][mIndex] = {sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]),
+                                            sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]),
+                                            cos (rayZod_radian[nIndex][mIndex])};
+        }
+    }
 
-  H_usn.resize (uSize);
-  for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
+  // phase term of each ray at each transmit element, txRayPhase[s][n][m]
+  // NOTE Doppler is computed in the CalcBeamformingGain function and is simplified to only account for the center anngle of each cluster.
+  Complex3DVector txRayPhase (sSize);
+  for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
     {
-      H_usn[uIndex].resize (sSize);
-      for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
+      //lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+      Vector sLoc = sAntenna->GetElementLocation (sIndex);
+      txRayPhase[sIndex].resize (numReducedCluster);
+      for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
         {
-          H_usn[uIndex][sIndex].resize (numReducedCluster);
+          txRayPhase[sIndex][nIndex].resize (raysPerCluster);
+          for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+            {
+              const DoubleVector &dir = txRayDirection[nIndex][mIndex];
+              double txPhaseDiff = 2 * M_PI * (dir[0] * sLoc.x + dir[1] * sLoc.y + dir[2] * sLoc.z);
+              txRayPhase[sIndex][nIndex][mIndex] = exp (std::complex<double> (0, txPhaseDiff));
+            }
         }
     }
 
+  // terms of the LOS ray which do not depend on the antenna elements
+  std::complex<double> losRay (0,0);
+  double K_linear = pow (10,K_factor / 10);
+  if (los)
+    {
+      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
+      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (uAngle.phi, uAngle.theta));
+      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (sAngle.phi, sAngle.theta));
+
+      double lambda = 3e8 / m_frequency; // the wavelength of the carrier frequency
+
+      losRay = (rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi)
+        * exp (std::complex<double> (0, -2 * M_PI * dis3D / lambda));
+    }
+
   // The following for loops computes the channel coefficients
+  Complex2DVector rxRayPhase (numReducedCluster); // phase term of ray m of cluster n at the current receive element
+  for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+    {
+      rxRayPhase[nIndex].resize (raysPerCluster);
+    }
   for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
     {
       Vector uLoc = uAntenna->GetElementLocation (uIndex);
 
+      for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+        {
+          for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+            {
+              const DoubleVector &dir = rxRayDirection[nIndex][mIndex];
+              double rxPhaseDiff = 2 * M_PI * (dir[0] * uLoc.x + dir[1] * uLoc.y + dir[2] * uLoc.z);
+              rxRayPhase[nIndex][mIndex] = exp (std::complex<double> (0, rxPhaseDiff));
+            }
+        }
+
       for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
         {
 
           Vector sLoc = sAntenna->GetElementLocation (sIndex);
 
+          uint8_t subClusterIndex = numReducedCluster; // position of the next sub-cluster
           for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
             {
               //Compute the N-2 weakest cluster, only vertical polarization. (7.5-22)
@@ -1614,31 +1694,12 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
                   std::complex<double> rays (0,0);
                   for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                      DoubleVector initialPhase = clusterPhase[nIndex][mIndex];
-                      double k = crossPolarizationPowerRatios[nIndex][mIndex];
-                      //lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                      double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
-                                                       + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
-                                                       + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
-
-                      double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
-                                                       + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
-                                                       + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
-                      // NOTE Doppler is computed in the CalcBeamformingGain function and is simplified to only account for the center anngle of each cluster.
-
-                      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-                      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
-                      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
-
-                      rays += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                               +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                               +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                               +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                        * exp (std::complex<double> (0, rxPhaseDiff))
-                        * exp (std::complex<double> (0, txPhaseDiff));
+                      rays += rayPolarization[nIndex][mIndex]
+                        * rxRayPhase[nIndex][mIndex]
+                        * txRayPhase[sIndex][nIndex][mIndex];
                     }
                   rays *= sqrt (clusterPower[nIndex] / raysPerCluster);
-                  H_usn[uIndex][sIndex][nIndex] = rays;
+                  H_usn (uIndex, sIndex, nIndex) = rays;
                 }
               else  //(7.5-28)
                 {
@@ -1648,21 +1709,10 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
 
                   for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                      double k = crossPolarizationPowerRatios[nIndex][mIndex];
-
                       //ZML:Just remind me that the angle offsets for the 3 subclusters were not generated correctly.
-
-                      DoubleVector initialPhase = clusterPhase[nIndex][mIndex];
-                      double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
-                                                       + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
-                                                       + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
-                      double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
-                                                       + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
-                                                       + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
-
-                      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-                      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
-                      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
+                      std::complex<double> ray = rayPolarization[nIndex][mIndex]
+                        * rxRayPhase[nIndex][mIndex]
+                        * txRayPhase[sIndex][nIndex][mIndex];
 
                       switch (mIndex)
                         {
@@ -1672,46 +1722,30 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
                           case 12:
                           case 17:
                           case 18:
-                            raysSub2 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
+                            raysSub2 += ray;
                             break;
                           case 13:
                           case 14:
                           case 15:
                           case 16:
-                            raysSub3 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
+                            raysSub3 += ray;
                             break;
                           default:                      //case 1,2,3,4,5,6,7,8,19,20
-                            raysSub1 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
+                            raysSub1 += ray;
                             break;
                         }
                     }
                   raysSub1 *= sqrt (clusterPower[nIndex] / raysPerCluster);
                   raysSub2 *= sqrt (clusterPower[nIndex] / raysPerCluster);
                   raysSub3 *= sqrt (clusterPower[nIndex] / raysPerCluster);
-                  H_usn[uIndex][sIndex][nIndex] = raysSub1;
-                  H_usn[uIndex][sIndex].push_back (raysSub2);
-                  H_usn[uIndex][sIndex].push_back (raysSub3);
+                  H_usn (uIndex, sIndex, nIndex) = raysSub1;
+                  H_usn (uIndex, sIndex, subClusterIndex++) = raysSub2;
+                  H_usn (uIndex, sIndex, subClusterIndex++) = raysSub3;
 
                 }
             }
           if (los) //(7.5-29) && (7.5-30)
             {
-              std::complex<double> ray (0,0);
               double rxPhaseDiff = 2 * M_PI * (sin (uAngle.theta) * cos (uAngle.phi) * uLoc.x
                                                + sin (uAngle.theta) * sin (uAngle.phi) * uLoc.y
                                                + cos (uAngle.theta) * uLoc.z);
@@ -1719,24 +1753,16 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
                                                + sin (sAngle.theta) * sin (sAngle.phi) * sLoc.y
                                                + cos (sAngle.theta) * sLoc.z);
 
-              double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-              std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (uAngle.phi, uAngle.theta));
-              std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (sAngle.phi, sAngle.theta));
-
-              double lambda = 3e8 / m_frequency; // the wavelength of the carrier frequency
-
-              ray = (rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi)
-                * exp (std::complex<double> (0, -2 * M_PI * dis3D / lambda))
+              std::complex<double> ray = losRay
                 * exp (std::complex<double> (0, rxPhaseDiff))
                 * exp (std::complex<double> (0, txPhaseDiff));
 
-              double K_linear = pow (10,K_factor / 10);
               // the LOS path should be attenuated if blockage is enabled.
-              H_usn[uIndex][sIndex][0] = sqrt (1 / (K_linear + 1)) * H_usn[uIndex][sIndex][0] + sqrt (K_linear / (1 + K_linear)) * ray / pow (10,attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
-              double tempSize = H_usn[uIndex][sIndex].size ();
+              H_usn (uIndex, sIndex, 0) = sqrt (1 / (K_linear + 1)) * H_usn (uIndex, sIndex, 0) + sqrt (K_linear / (1 + K_linear)) * ray / pow (10,attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
+              double tempSize = H_usn.GetNumPages ();
               for (uint8_t nIndex = 1; nIndex < tempSize; nIndex++)
                 {
-                  H_usn[uIndex][sIndex][nIndex] *= sqrt (1 / (K_linear + 1)); //(7.5-30) for tau = tau2...taunN
+                  H_usn (uIndex, sIndex, nIndex) *= sqrt (1 / (K_linear + 1)); //(7.5-30) for tau = tau2...taunN
                 }
 
             }
@@ -1802,9 +1828,9 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
 
     }
 
-  NS_LOG_INFO ("size of coefficient matrix =[" << H_usn.size () << "][" << H_usn[0].size () << "][" << H_usn[0][0].size () << "]");
+  NS_LOG_INFO ("size of coefficient matrix =[" << H_usn.GetNumRows () << "][" << H_usn.GetNumCols () << "][" << H_usn.GetNumPages () << "]");
 
-  channelParams->m_channel = H_usn;
+  channelParams->m_channel = std::move (H_usn);
   channelParams->m_delay = clusterDelay;
 
   channelParams->m_angle.clear ();
@@ -134,22 +134,28 @@ ThreeGppSpectrumPropagationLossModel::CalcLongTerm (Ptr<const MatrixBasedChannel
   NS_LOG_DEBUG ("CalcLongTerm with sAntenna " << sAntenna << " uAntenna " << uAntenna);
   //store the long term part to reduce computation load
   //only the small scale fading needs to be updated if the large scale parameters and antenna weights remain unchanged.
-  ThreeGppAntennaArrayModel::ComplexVector longTerm;
-  uint8_t numCluster = static_cast<uint8_t> (params->m_channel[0][0].size ());
-
-  for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+  uint8_t numCluster = static_cast<uint8_t> (params->m_channel.GetNumPages ());
+  ThreeGppAntennaArrayModel::ComplexVector longTerm (numCluster);
+
+  // the coefficients of all the clusters are contiguous for each (u, s)
+  // pair, hence the cluster index is the innermost loop. The sums are
+  // accumulated in the same order as a per-cluster loop would.
+  ThreeGppAntennaArrayModel::ComplexVector rxSum (numCluster);
+  for (uint16_t sIndex = 0; sIndex < sAntenna; sIndex++)
     {
-      std::complex<double> txSum (0,0);
-      for (uint16_t sIndex = 0; sIndex < sAntenna; sIndex++)
+      std::fill (rxSum.begin (), rxSum.end (), std::complex<double> (0,0));
+      for (uint16_t uIndex = 0; uIndex < uAntenna; uIndex++)
         {
-          std::complex<double> rxSum (0,0);
-          for (uint16_t uIndex = 0; uIndex < uAntenna; uIndex++)
+          const std::complex<double> *h = params->m_channel.GetPagesBegin (uIndex, sIndex);
+          for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
-              rxSum = rxSum + uW[uIndex] * params->m_channel[uIndex][sIndex][cIndex];
+              rxSum[cIndex] = rxSum[cIndex] + uW[uIndex] * h[cIndex];
             }
-          txSum = txSum + sW[sIndex] * rxSum;
         }
-      longTerm.push_back (txSum);
+      for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+        {
+          longTerm[cIndex] = longTerm[cIndex] + sW[sIndex] * rxSum[cIndex];
+        }
     }
   return longTerm;
 }
@@ -165,7 +171,7 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain (Ptr<SpectrumValue> tx
   Ptr<SpectrumValue> tempPsd = Copy<SpectrumValue> (txPsd);
 
   //channel[rx][tx][cluster]
-  uint8_t numCluster = static_cast<uint8_t> (params->m_channel[0][0].size ());
+  uint8_t numCluster = static_cast<uint8_t> (params->m_channel.GetNumPages ());
 
   // compute the doppler term
   // NOTE the update of Doppler is simplified by only taking the center angle of
@@ -223,6 +223,11 @@ SpectrumValueTestSuite::SpectrumValueTestSuite ()
   AddTestCase (new SpectrumValueTestCase (tv9b, v9, "tv9b =  doubleValue * v1"), TestCase::QUICK);
   AddTestCase (new SpectrumValueTestCase (tv10b, v10, "tv10b = doubleValue div v1"), TestCase::QUICK);
 
+  SpectrumValue tv11 (f);
+  tv11 = v1;
+  tv11.AddScaled (v2, doubleValue);
+  AddTestCase (new SpectrumValueTestCase (tv11, v1 + v2 * doubleValue, "tv11 = v1 + v2 * doubleValue (in place)"), TestCase::QUICK);
+
 
 
 
@@ -94,7 +94,7 @@ ThreeGppChannelMatrixComputationTest::DoComputeNorm (Ptr<ThreeGppChannelModel> c
   Ptr<const ThreeGppChannelModel::ChannelMatrix> channelMatrix = channelModel->GetChannel (txMob, rxMob, txAntenna, rxAntenna);
 
   double channelNorm = 0;
-  uint8_t numTotClusters = channelMatrix->m_channel.at (0).at (0).size ();
+  uint8_t numTotClusters = channelMatrix->m_channel.GetNumPages ();
   for (uint8_t cIndex = 0; cIndex < numTotClusters; cIndex++)
   {
     double clusterNorm = 0;
@@ -102,7 +102,7 @@ ThreeGppChannelMatrixComputationTest::DoComputeNorm (Ptr<ThreeGppChannelModel> c
     {
       for (uint32_t uIndex = 0; uIndex < rxAntennaElements; uIndex++)
       {
-        clusterNorm += std::pow (std::abs (channelMatrix->m_channel.at (uIndex).at (sIndex).at (cIndex)), 2);
+        clusterNorm += std::pow (std::abs (channelMatrix->m_channel (uIndex, sIndex, cIndex)), 2);
       }
     }
     channelNorm += clusterNorm;
@@ -160,8 +160,8 @@ ThreeGppChannelMatrixComputationTest::DoRun (void)
   Ptr<const ThreeGppChannelModel::ChannelMatrix> channelMatrix = channelModel->GetChannel (txMob, rxMob, txAntenna, rxAntenna);
 
   // check the channel matrix dimensions
-  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.at (0).size (), txAntennaElements [0] * txAntennaElements [1], "The second dimension of H should be equal to the number of tx antenna elements");
-  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.size (), rxAntennaElements [0] * rxAntennaElements [1], "The first dimension of H should be equal to the number of rx antenna elements");
+  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.GetNumCols (), txAntennaElements [0] * txAntennaElements [1], "The second dimension of H should be equal to the number of tx antenna elements");
+  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.GetNumRows (), rxAntennaElements [0] * rxAntennaElements [1], "The first dimension of H should be equal to the number of rx antenna elements");
 
   // test if the channel matrix is correctly generated
   uint16_t numIt = 1000;
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the resolution of the Config
+// paths done while setting up the traces of a large scenario.  'nodes'
+// nodes get an Internet stack and a TCP socket, then 'rounds' times the
+// IPv4, IPv6 and TCP trace sources of all the nodes are connected through
+// Config::Connect, and some of their attributes set through Config::Set.
+// Finally, 'n' lookups of an attribute declared by a parent of
+// TcpSocketBase compare TypeId::LookupAttributeByName with a scan of
+// the attributes of each TypeId of the hierarchy.
+// Sample usage:  ./waf --run 'bench-config --nodes=500 --rounds=10 --n=100000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/config.h"
+#include "ns3/uinteger.h"
+#include "ns3/node-container.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4.h"
+#include "ns3/ipv6.h"
+#include "ns3/socket.h"
+#include "ns3/tcp-socket-factory.h"
+#include <iostream>
+#include <vector>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+/**
+ * IPv4 trace sink
+ * \param context the trace context
+ * \param packet the packet
+ * \param ipv4 the Ipv4 protocol
+ * \param interface the interface index
+ */
+static void
+Ipv4TxRx (std::string context, Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface)
+{
+}
+
+/**
+ * IPv6 trace sink
+ * \param context the trace context
+ * \param packet the packet
+ * \param ipv6 the Ipv6 protocol
+ * \param interface the interface index
+ */
+static void
+Ipv6TxRx (std::string context, Ptr<const Packet> packet, Ptr<Ipv6> ipv6, uint32_t interface)
+{
+}
+
+/**
+ * TCP congestion window trace sink
+ * \param context the trace context
+ * \param oldValue the old congestion window
+ * \param newValue the new congestion window
+ */
+static void
+CwndChange (std::string context, uint32_t oldValue, uint32_t newValue)
+{
+}
+
+/**
+ * Finds an attribute by scanning the attributes of a TypeId and of
+ * its parents
+ * \param tid the TypeId
+ * \param name the attribute name
+ * \param info the attribute information, if found
+ * \return true if the attribute was found
+ */
+static bool
+ScanAttributes (TypeId tid, std::string name, struct TypeId::AttributeInformation *info)
+{
+  TypeId nextTid = tid;
+  do
+    {
+      tid = nextTid;
+      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation tmp = tid.GetAttribute (i);
+          if (tmp.name == name)
+            {
+              *info = tmp;
+              return true;
+            }
+        }
+      nextTid = tid.GetParent ();
+    }
+  while (nextTid != tid);
+  return false;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t nodes = 500;
+  uint32_t rounds = 10;
+  uint32_t n = 100000;
+
+  CommandLine cmd;
+  cmd.Usage ("Benchmark the resolution of Config paths");
+  cmd.AddValue ("nodes", "number of nodes", nodes);
+  cmd.AddValue ("rounds", "number of times the paths are resolved", rounds);
+  cmd.AddValue ("n", "number of attribute lookups", n);
+  cmd.Parse (argc, argv);
+
+  if (nodes == 0)
+    {
+      std::cerr << "Error-- the number of nodes must be positive" << std::endl;
+      exit (1);
+    }
+  std::cout << "Running bench-config with nodes=" << nodes << " rounds=" << rounds << " n=" << n << std::endl;
+
+  NodeContainer container;
+  container.Create (nodes);
+  InternetStackHelper internet;
+  internet.Install (container);
+  std::vector<Ptr<Socket> > sockets;
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      sockets.push_back (Socket::CreateSocket (container.Get (i), TcpSocketFactory::GetTypeId ()));
+    }
+
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < rounds; i++)
+    {
+      Config::Connect ("/NodeList/*/$ns3::Ipv4L3Protocol/Tx", MakeCallback (&Ipv4TxRx));
+      Config::Connect ("/NodeList/*/$ns3::Ipv4L3Protocol/Rx", MakeCallback (&Ipv4TxRx));
+      Config::Connect ("/NodeList/*/$ns3::Ipv6L3Protocol/Tx", MakeCallback (&Ipv6TxRx));
+      Config::Connect ("/NodeList/*/$ns3::Ipv6L3Protocol/Rx", MakeCallback (&Ipv6TxRx));
+      Config::Connect ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/CongestionWindow", MakeCallback (&CwndChange));
+    }
+  uint64_t connectMs = time.End ();
+
+  time.Start ();
+  for (uint32_t i = 0; i < rounds; i++)
+    {
+      Config::Set ("/NodeList/*/$ns3::Ipv4L3Protocol/DefaultTtl", UintegerValue (32 + i));
+      Config::Set ("/NodeList/*/$ns3::Ipv6L3Protocol/DefaultTtl", UintegerValue (32 + i));
+      Config::Set ("/NodeList/*/$ns3::TcpL4Protocol/SocketList/*/SndBufSize", UintegerValue (131072 + i));
+    }
+  uint64_t setMs = time.End ();
+
+  std::cout << "Config::Connect: " << 5 * rounds * nodes << " trace sources in " << connectMs << " ms" << std::endl;
+  std::cout << "Config::Set: " << 3 * rounds * nodes << " attributes in " << setMs << " ms" << std::endl;
+
+  // SndBufSize is declared by TcpSocket, the parent of TcpSocketBase
+  TypeId tid = sockets[0]->GetInstanceTypeId ();
+  struct TypeId::AttributeInformation info;
+  uint32_t found = 0;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      found += ScanAttributes (tid, "SndBufSize", &info);
+    }
+  uint64_t scanMs = time.End ();
+
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      found += tid.LookupAttributeByName ("SndBufSize", &info);
+    }
+  uint64_t lookupMs = time.End ();
+
+  std::cout << tid.GetName () << " attribute lookups: " << n << " scans in " << scanMs << " ms, "
+            << n << " LookupAttributeByName in " << lookupMs << " ms"
+            << " (" << found << " found)" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the transport endpoint
+// demultiplexers with a server terminating many concurrent connections.
+// 'flows' connected endpoints share one listening port, and 'n' lookups
+// are performed, round robin over the connections, plus one lookup
+// per flow hitting the listener.
+// Sample usage:  ./waf --run 'bench-endpoint-demux --flows=10000 --n=1000000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/ipv6-interface.h"
+#include <iostream>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+static const uint16_t SERVER_PORT = 80; //!< listening port of the server
+
+/**
+ * Builds the IPv4 address of the i-th client
+ * \param i client index
+ * \return the client address
+ */
+static Ipv4Address
+GetClientAddress4 (uint32_t i)
+{
+  return Ipv4Address (0x0b000000 + i / 1000);
+}
+
+/**
+ * Builds the IPv6 address of the i-th client
+ * \param i client index
+ * \return the client address
+ */
+static Ipv6Address
+GetClientAddress6 (uint32_t i)
+{
+  uint8_t buf[16] = {0x20, 0x01, 0x0d, 0xb8};
+  buf[14] = (i / 1000) >> 8;
+  buf[15] = (i / 1000) & 0xff;
+  return Ipv6Address (buf);
+}
+
+/**
+ * Builds the port of the i-th client
+ * \param i client index
+ * \return the client port
+ */
+static uint16_t
+GetClientPort (uint32_t i)
+{
+  return 10000 + i % 1000;
+}
+
+static void
+benchIpv4 (uint32_t flows, uint32_t n)
+{
+  Ipv4EndPointDemux demux;
+  Ipv4Address server ("10.0.0.1");
+  Ptr<Ipv4Interface> interface = CreateObject<Ipv4Interface> ();
+  demux.Allocate (0, server, SERVER_PORT);
+  for (uint32_t i = 0; i < flows; i++)
+    {
+      demux.Allocate (0, server, SERVER_PORT, GetClientAddress4 (i), GetClientPort (i));
+    }
+
+  SystemWallClockMs time;
+  time.Start ();
+  uint32_t found = 0;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      uint32_t flow = i % flows;
+      found += demux.Lookup (server, SERVER_PORT, GetClientAddress4 (flow),
+                             GetClientPort (flow), interface).size ();
+    }
+  uint64_t connectedMs = time.End ();
+
+  time.Start ();
+  for (uint32_t i = 0; i < flows; i++)
+    {
+      found += demux.Lookup (server, SERVER_PORT, Ipv4Address ("12.0.0.1"),
+                             GetClientPort (i), interface).size ();
+    }
+  uint64_t listenerMs = time.End ();
+
+  std::cout << "IPv4: " << n << " connected lookups in " << connectedMs << " ms, "
+            << flows << " listener lookups in " << listenerMs << " ms"
+            << " (" << found << " matches)" << std::endl;
+}
+
+static void
+benchIpv6 (uint32_t flows, uint32_t n)
+{
+  Ipv6EndPointDemux demux;
+  Ipv6Address server ("2001:db8:ffff::1");
+  Ptr<Ipv6Interface> interface = CreateObject<Ipv6Interface> ();
+  demux.Allocate (0, server, SERVER_PORT);
+  for (uint32_t i = 0; i < flows; i++)
+    {
+      demux.Allocate (0, server, SERVER_PORT, GetClientAddress6 (i), GetClientPort (i));
+    }
+
+  SystemWallClockMs time;
+  time.Start ();
+  uint32_t found = 0;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      uint32_t flow = i % flows;
+      found += demux.Lookup (server, SERVER_PORT, GetClientAddress6 (flow),
+                             GetClientPort (flow), interface).size ();
+    }
+  uint64_t connectedMs = time.End ();
+
+  time.Start ();
+  for (uint32_t i = 0; i < flows; i++)
+    {
+      found += demux.Lookup (server, SERVER_PORT, Ipv6Address ("2001:db8:eeee::1"),
+                             GetClientPort (i), interface).size ();
+    }
+  uint64_t listenerMs = time.End ();
+
+  std::cout << "IPv6: " << n << " connected lookups in " << connectedMs << " ms, "
+            << flows << " listener lookups in " << listenerMs << " ms"
+            << " (" << found << " matches)" << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t flows = 10000;
+  uint32_t n = 1000000;
+
+  CommandLine cmd;
+  cmd.Usage ("Benchmark the IPv4 and IPv6 endpoint demultiplexers");
+  cmd.AddValue ("flows", "number of connected endpoints", flows);
+  cmd.AddValue ("n", "number of lookups of connected endpoints", n);
+  cmd.Parse (argc, argv);
+
+  if (flows == 0)
+    {
+      std::cerr << "Error-- the number of flows must be positive" << std::endl;
+      exit (1);
+    }
+  std::cout << "Running bench-endpoint-demux with flows=" << flows << " n=" << n << std::endl;
+
+  benchIpv4 (flows, n);
+  benchIpv6 (flows, n);
+
+  return 0;
+}
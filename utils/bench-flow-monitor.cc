@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the per-packet overhead of
+// FlowMonitor.  'n' UDP packets spread over 'flows' flows are
+// classified by an Ipv4FlowClassifier and reported as transmitted,
+// forwarded once and received; 'inflight' packets are kept in flight,
+// i.e., tracked by the monitor, at any time.
+// Sample usage:  ./waf --run 'bench-flow-monitor --flows=1000 --inflight=10000 --n=1000000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/ipv4-flow-probe.h"
+#include <iostream>
+#include <vector>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+int main (int argc, char *argv[])
+{
+  uint32_t flows = 1000;
+  uint32_t inflight = 10000;
+  uint32_t n = 1000000;
+
+  CommandLine cmd;
+  cmd.Usage ("Benchmark the per-packet overhead of FlowMonitor");
+  cmd.AddValue ("flows", "number of flows", flows);
+  cmd.AddValue ("inflight", "number of packets tracked at any time", inflight);
+  cmd.AddValue ("n", "number of packets", n);
+  cmd.Parse (argc, argv);
+
+  if (flows == 0 || inflight == 0)
+    {
+      std::cerr << "Error-- the number of flows and of packets in flight must be positive" << std::endl;
+      exit (1);
+    }
+  std::cout << "Running bench-flow-monitor with flows=" << flows << " inflight=" << inflight
+            << " n=" << n << std::endl;
+
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+
+  Ptr<FlowMonitor> monitor = CreateObject<FlowMonitor> ();
+  Ptr<Ipv4FlowClassifier> classifier = Create<Ipv4FlowClassifier> ();
+  monitor->AddFlowClassifier (classifier);
+  Ptr<Ipv4FlowProbe> probe = Create<Ipv4FlowProbe> (monitor, classifier, node);
+  monitor->StartRightNow ();
+
+  // UDP payloads carry the ports in their first four bytes
+  std::vector<Ptr<Packet> > payloads;
+  std::vector<Ipv4Header> headers;
+  for (uint32_t i = 0; i < flows; i++)
+    {
+      uint16_t srcPort = 10000 + i % 1000;
+      uint8_t ports[4] = {uint8_t (srcPort >> 8), uint8_t (srcPort & 0xff), 0, 80};
+      payloads.push_back (Create<Packet> (ports, 4));
+      Ipv4Header header;
+      header.SetSource (Ipv4Address (0x0b000000 + i / 1000));
+      header.SetDestination (Ipv4Address ("10.0.0.1"));
+      header.SetProtocol (17);
+      headers.push_back (header);
+    }
+
+  std::vector<std::pair<uint32_t, uint32_t> > tracked (inflight);
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      uint32_t flow = i % flows;
+      std::pair<uint32_t, uint32_t> &slot = tracked[i % inflight];
+      if (i >= inflight)
+        {
+          monitor->ReportLastRx (probe, slot.first, slot.second, 1000);
+        }
+      classifier->Classify (headers[flow], payloads[flow], &slot.first, &slot.second);
+      monitor->ReportFirstTx (probe, slot.first, slot.second, 1000);
+      monitor->ReportForwarding (probe, slot.first, slot.second, 1000);
+    }
+  uint64_t deltaMs = time.End ();
+
+  std::cout << n << " packets in " << deltaMs << " ms ("
+            << (n > 0 ? deltaMs * 1e6 / n : 0) << " ns per packet)" << std::endl;
+
+  monitor->Dispose ();
+  return 0;
+}
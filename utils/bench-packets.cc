@@ -343,16 +343,24 @@ static void
 runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name)
 {
   uint64_t minDelay = std::numeric_limits<uint64_t>::max();
+  Packet::AllocationStats before = Packet::GetAllocationStats ();
   for (uint32_t i = 0; i < minIterations; i++)
     {
       uint64_t delay = runBenchOneIteration(bench, n);
       minDelay = std::min(minDelay, delay);
     }
+  Packet::AllocationStats after = Packet::GetAllocationStats ();
   double ps = n;
   ps *= 1000;
   ps /= minDelay;
+  double allocations = after.bufferAllocations - before.bufferAllocations
+    + after.metadataAllocations - before.metadataAllocations
+    + after.byteTagAllocations - before.byteTagAllocations
+    + after.packetTagAllocations - before.packetTagAllocations;
+  allocations /= (double) n * minIterations;
   std::cout << ps << " packets/s"
-            << " (" << minDelay << " ms elapsed)\t"
+            << " (" << minDelay << " ms elapsed, "
+            << allocations << " allocations/packet)\t"
             << name
             << std::endl;
 }
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the Time operations found on
+// the hot paths of the TCP and mmWave models: the conversions to and
+// from seconds of the RTT and pacing computations, the transmission
+// times of DataRate, and the integer arithmetic of the slot timing.
+// Each operation is run 'n' times.
+// Sample usage:  ./waf --run 'bench-time --n=10000000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/data-rate.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/**
+ * Print the result of a benchmark
+ * \param name the benchmark name
+ * \param n the number of operations
+ * \param ms the time taken, in milliseconds
+ * \param check a value computed by the benchmark, to keep it alive
+ */
+static void
+Report (std::string name, uint32_t n, uint64_t ms, double check)
+{
+  std::cout << std::left << std::setw (28) << name
+            << std::right << std::setw (8) << ms << " ms "
+            << std::setw (10) << (n ? ms * 1e6 / n : 0) << " ns/op"
+            << "  (" << check << ")" << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t n = 10000000;
+
+  CommandLine cmd;
+  cmd.Usage ("Benchmark the Time operations of the TCP and mmWave models");
+  cmd.AddValue ("n", "number of operations of each kind", n);
+  cmd.Parse (argc, argv);
+
+  std::cout << "Running bench-time with n=" << n << std::endl;
+
+  // Running the simulator freezes the time resolution, which stops the
+  // bookkeeping done for every Time built during the configuration
+  Simulator::Run ();
+
+  SystemWallClockMs time;
+  Time t = MilliSeconds (123) + NanoSeconds (456);
+  Time acc;
+  double sum = 0;
+
+  // RTT samples and timers: GetSeconds of a Time
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      sum += (t + NanoSeconds (i)).GetSeconds ();
+    }
+  Report ("Time::GetSeconds", n, time.End (), sum);
+
+  // RTO and pacing intervals: Seconds of a double
+  sum = 0;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      acc += Seconds (1e-6 * (i & 1023));
+    }
+  Report ("Seconds (double)", n, time.End (), acc.GetDouble ());
+
+  // RTT smoothing: scaling a Time by a double
+  acc = Time ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      acc = acc * 0.875 + t * 0.125;
+    }
+  Report ("Time * double", n, time.End (), acc.GetDouble ());
+
+  // Time ratios
+  sum = 0;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      sum += ((t + NanoSeconds (i)) / t).GetDouble ();
+    }
+  Report ("Time / Time", n, time.End (), sum);
+
+  // Transmission and pacing times
+  DataRate rate ("1Gbps");
+  acc = Time ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      acc += rate.CalculateBytesTxTime (1 + (i & 2047));
+    }
+  Report ("CalculateBytesTxTime", n, time.End (), acc.GetDouble ());
+
+  // Slot timing: integer multiples of the symbol period
+  Time symbolPeriod = NanoSeconds (8929);
+  acc = Time ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      acc += NanoSeconds ((i % 14) * symbolPeriod.GetNanoSeconds ()) + symbolPeriod * (i % 14);
+    }
+  Report ("slot timing", n, time.End (), acc.GetDouble ());
+
+  Simulator::Destroy ();
+  return 0;
+}